@@ -0,0 +1,39 @@
+// font6x8_tr.c - Font6x8'i Türkçe karakterlerle genişletir (ssd1322_font_t)
+
+#include "font6x8.h"
+#include "oled_font.h"
+
+static const uint8_t Font6x8_Latin1[7][6] = {
+  {0x06,0x09,0x09,0x06,0x00,0x00}, // U+00B0 '°'
+  {0x3E,0x41,0xC1,0x41,0x22,0x00}, // U+00C7 'Ç'
+  {0x3C,0x43,0x42,0x43,0x3C,0x00}, // U+00D6 'Ö'
+  {0x3C,0x41,0x40,0x41,0x3C,0x00}, // U+00DC 'Ü'
+  {0x38,0x44,0xC4,0x44,0x20,0x00}, // U+00E7 'ç'
+  {0x38,0x45,0x44,0x45,0x38,0x00}, // U+00F6 'ö'
+  {0x3C,0x41,0x40,0x21,0x7C,0x00}, // U+00FC 'ü'
+};
+
+static const uint8_t Font6x8_LatinExtA[6][6] = {
+  {0x38,0x45,0x45,0x55,0x30,0x00}, // U+011E 'Ğ'
+  {0x08,0x15,0x55,0x55,0x3C,0x00}, // U+011F 'ğ'
+  {0x00,0x44,0x7D,0x44,0x00,0x00}, // U+0130 'İ'
+  {0x00,0x44,0x7C,0x40,0x00,0x00}, // U+0131 'ı'
+  {0x22,0xA5,0xE5,0x25,0x19,0x00}, // U+015E 'Ş'
+  {0x48,0x54,0xD4,0x54,0x20,0x00}, // U+015F 'ş'
+};
+
+static const ssd1322_font_block_t Font6x8_TR_Blocks[3] = {
+  { {0x00000000,0xFFFFFFFF,0xFFFFFFFF,0xFFFFFFFF}, {0,0,32,64}, &Font6x8[0][0] },        // U+0020..U+007F
+  { {0x00000000,0x00010000,0x10400080,0x10400080}, {0,0,1,4}, &Font6x8_Latin1[0][0] }, // U+0080..U+00FF
+  { {0xC0000000,0x00030000,0xC0000000,0x00000000}, {0,2,4,6}, &Font6x8_LatinExtA[0][0] }, // U+0100..U+017F
+};
+
+static const uint8_t Font6x8_TR_Map[3] = { 0, 1, 2 };
+
+const ssd1322_font_t Font6x8_TR = {
+    Font6x8_TR_Map, Font6x8_TR_Blocks, 3,
+    6, 8,   // w, h
+    7,      // 6px + 1px boşluk
+    1,      // col_bytes
+    '?'
+};
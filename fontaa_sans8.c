@@ -0,0 +1,263 @@
+/* FontAA_Sans8 - DejaVu Sans (Bitstream Vera / DejaVu lisansı), 8 piksel, 4x süper örnekleme (tools/ssd1322_aafont) */
+
+#include "oled_aafont.h"
+
+static const uint16_t FontAA_Sans8_codes[108] = {
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B,
+    0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043,
+    0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B,
+    0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+    0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x00B0,
+    0x00C7, 0x00D6, 0x00DC, 0x00E7, 0x00F6, 0x00FC, 0x011E, 0x011F, 0x0130, 0x0131, 0x015E, 0x015F,
+};
+
+static const ssd1322_aa_glyph_t FontAA_Sans8_glyphs[108] = {
+    {     0,  0,  0,  0,  0,  3 },   /* U+0020 */
+    {     0,  1,  7,  1,  1,  3 },   /* U+0021 '!' */
+    {    14,  3,  3,  0,  1,  4 },   /* U+0022 '"' */
+    {    23,  6,  7,  0,  1,  7 },   /* U+0023 '#' */
+    {    46,  5,  8,  0,  1,  5 },   /* U+0024 '$' */
+    {    71,  8,  7,  0,  1,  8 },   /* U+0025 '%' */
+    {   100,  6,  7,  0,  1,  6 },   /* U+0026 '&' */
+    {   123,  2,  3,  0,  1,  2 },   /* U+0027 ''' */
+    {   129,  3,  8,  0,  1,  3 },   /* U+0028 '(' */
+    {   145,  3,  8,  0,  1,  3 },   /* U+0029 ')' */
+    {   161,  4,  5,  0,  1,  4 },   /* U+002A */
+    {   173,  6,  6,  0,  2,  7 },   /* U+002B '+' */
+    {   189,  2,  3,  0,  6,  3 },   /* U+002C ',' */
+    {   195,  3,  1,  0,  5,  3 },   /* U+002D '-' */
+    {   198,  1,  2,  1,  6,  3 },   /* U+002E '.' */
+    {   202,  3,  8,  0,  1,  3 },   /* U+002F */
+    {   218,  5,  7,  0,  1,  5 },   /* U+0030 '0' */
+    {   244,  5,  7,  0,  1,  5 },   /* U+0031 '1' */
+    {   261,  5,  7,  0,  1,  5 },   /* U+0032 '2' */
+    {   282,  5,  7,  0,  1,  5 },   /* U+0033 '3' */
+    {   301,  5,  7,  0,  1,  5 },   /* U+0034 '4' */
+    {   321,  5,  7,  0,  1,  5 },   /* U+0035 '5' */
+    {   342,  5,  7,  0,  1,  5 },   /* U+0036 '6' */
+    {   364,  5,  7,  0,  1,  5 },   /* U+0037 '7' */
+    {   382,  5,  7,  0,  1,  5 },   /* U+0038 '8' */
+    {   408,  5,  7,  0,  1,  5 },   /* U+0039 '9' */
+    {   432,  1,  5,  1,  3,  3 },   /* U+003A ':' */
+    {   441,  2,  6,  0,  3,  3 },   /* U+003B ';' */
+    {   452,  6,  5,  0,  2,  7 },   /* U+003C '<' */
+    {   468,  6,  4,  0,  3,  7 },   /* U+003D '=' */
+    {   484,  6,  5,  0,  2,  7 },   /* U+003E '>' */
+    {   499,  4,  7,  0,  1,  4 },   /* U+003F '?' */
+    {   514,  8,  8,  0,  1,  8 },   /* U+0040 '@' */
+    {   547,  6,  7,  0,  1,  6 },   /* U+0041 'A' */
+    {   570,  5,  7,  0,  1,  6 },   /* U+0042 'B' */
+    {   597,  6,  7,  0,  1,  6 },   /* U+0043 'C' */
+    {   617,  6,  7,  0,  1,  6 },   /* U+0044 'D' */
+    {   644,  5,  7,  0,  1,  5 },   /* U+0045 'E' */
+    {   668,  4,  7,  0,  1,  5 },   /* U+0046 'F' */
+    {   685,  6,  7,  0,  1,  6 },   /* U+0047 'G' */
+    {   709,  6,  7,  0,  1,  6 },   /* U+0048 'H' */
+    {   737,  2,  7,  0,  1,  2 },   /* U+0049 'I' */
+    {   751,  3,  8, -1,  1,  2 },   /* U+004A 'J' */
+    {   768,  6,  7,  0,  1,  5 },   /* U+004B 'K' */
+    {   793,  5,  7,  0,  1,  5 },   /* U+004C 'L' */
+    {   811,  6,  7,  0,  1,  7 },   /* U+004D 'M' */
+    {   839,  6,  7,  0,  1,  6 },   /* U+004E 'N' */
+    {   867,  6,  7,  0,  1,  6 },   /* U+004F 'O' */
+    {   893,  5,  7,  0,  1,  5 },   /* U+0050 'P' */
+    {   915,  6,  8,  0,  1,  6 },   /* U+0051 'Q' */
+    {   943,  6,  7,  0,  1,  6 },   /* U+0052 'R' */
+    {   970,  5,  7,  0,  1,  5 },   /* U+0053 'S' */
+    {   992,  5,  7,  0,  1,  5 },   /* U+0054 'T' */
+    {  1010,  6,  7,  0,  1,  6 },   /* U+0055 'U' */
+    {  1037,  6,  7,  0,  1,  6 },   /* U+0056 'V' */
+    {  1060,  8,  7,  0,  1,  8 },   /* U+0057 'W' */
+    {  1092,  6,  7,  0,  1,  6 },   /* U+0058 'X' */
+    {  1116,  5,  7,  0,  1,  5 },   /* U+0059 'Y' */
+    {  1136,  5,  7,  0,  1,  6 },   /* U+005A 'Z' */
+    {  1159,  3,  8,  0,  1,  3 },   /* U+005B '[' */
+    {  1178,  3,  8,  0,  1,  3 },   /* U+005C '\' */
+    {  1194,  3,  8,  0,  1,  3 },   /* U+005D ']' */
+    {  1213,  6,  3,  0,  1,  7 },   /* U+005E '^' */
+    {  1222,  4,  2,  0,  8,  4 },   /* U+005F '_' */
+    {  1228,  3,  2,  0,  1,  4 },   /* U+0060 '`' */
+    {  1232,  5,  5,  0,  3,  5 },   /* U+0061 'a' */
+    {  1249,  5,  7,  0,  1,  5 },   /* U+0062 'b' */
+    {  1272,  4,  5,  0,  3,  5 },   /* U+0063 'c' */
+    {  1285,  5,  7,  0,  1,  5 },   /* U+0064 'd' */
+    {  1308,  5,  5,  0,  3,  5 },   /* U+0065 'e' */
+    {  1327,  3,  7,  0,  1,  3 },   /* U+0066 'f' */
+    {  1343,  5,  7,  0,  3,  5 },   /* U+0067 'g' */
+    {  1368,  5,  7,  0,  1,  5 },   /* U+0068 'h' */
+    {  1392,  2,  7,  0,  1,  2 },   /* U+0069 'i' */
+    {  1406,  3,  9, -1,  1,  2 },   /* U+006A 'j' */
+    {  1425,  5,  7,  0,  1,  5 },   /* U+006B 'k' */
+    {  1446,  2,  7,  0,  1,  2 },   /* U+006C 'l' */
+    {  1460,  7,  5,  0,  3,  8 },   /* U+006D 'm' */
+    {  1485,  5,  5,  0,  3,  5 },   /* U+006E 'n' */
+    {  1505,  5,  5,  0,  3,  5 },   /* U+006F 'o' */
+    {  1524,  5,  7,  0,  3,  5 },   /* U+0070 'p' */
+    {  1547,  5,  7,  0,  3,  5 },   /* U+0071 'q' */
+    {  1570,  4,  5,  0,  3,  3 },   /* U+0072 'r' */
+    {  1581,  4,  5,  0,  3,  4 },   /* U+0073 's' */
+    {  1596,  3,  7,  0,  1,  3 },   /* U+0074 't' */
+    {  1612,  5,  5,  0,  3,  5 },   /* U+0075 'u' */
+    {  1631,  5,  5,  0,  3,  5 },   /* U+0076 'v' */
+    {  1646,  6,  5,  0,  3,  7 },   /* U+0077 'w' */
+    {  1665,  5,  5,  0,  3,  5 },   /* U+0078 'x' */
+    {  1682,  5,  7,  0,  3,  5 },   /* U+0079 'y' */
+    {  1702,  4,  5,  0,  3,  4 },   /* U+007A 'z' */
+    {  1716,  4,  8,  1,  1,  5 },   /* U+007B '{' */
+    {  1735,  1,  9,  1,  1,  3 },   /* U+007C '|' */
+    {  1753,  4,  8,  1,  1,  5 },   /* U+007D '}' */
+    {  1771,  6,  2,  0,  4,  7 },   /* U+007E '~' */
+    {  1779,  4,  4,  0,  1,  4 },   /* U+00B0 */
+    {  1789,  6,  8,  0,  1,  6 },   /* U+00C7 */
+    {  1811,  6,  8,  0,  0,  6 },   /* U+00D6 */
+    {  1840,  6,  8,  0,  0,  6 },   /* U+00DC */
+    {  1869,  4,  6,  0,  3,  5 },   /* U+00E7 */
+    {  1885,  5,  7,  0,  1,  5 },   /* U+00F6 */
+    {  1910,  5,  7,  0,  1,  5 },   /* U+00FC */
+    {  1935,  6,  8,  0,  0,  6 },   /* U+011E */
+    {  1962,  5,  9,  0,  1,  5 },   /* U+011F */
+    {  1991,  2,  8,  0,  0,  2 },   /* U+0130 */
+    {  2007,  2,  5,  0,  3,  2 },   /* U+0131 */
+    {  2017,  5,  8,  0,  1,  5 },   /* U+015E */
+    {  2042,  4,  6,  0,  3,  4 },   /* U+015F */
+};
+
+static const uint8_t FontAA_Sans8_atlas[2059] = {
+    0x01, 0x30, 0x01, 0xB0, 0x01, 0xB0, 0x01, 0xB0, 0x01, 0x60, 0x01, 0x60, 0x01, 0x60, 0x03, 0x12,
+    0x30, 0x03, 0x48, 0xB0, 0x03, 0x48, 0xB0, 0x24, 0x11, 0x21, 0x23, 0x73, 0x90, 0x15, 0xBD, 0xBD,
+    0xB0, 0x23, 0x92, 0x80, 0x06, 0x6B, 0xDC, 0xC6, 0x13, 0x64, 0x90, 0x13, 0x50, 0x40, 0x21, 0x60,
+    0x05, 0x19, 0xDA, 0x20, 0x05, 0x87, 0x81, 0x10, 0x04, 0x4C, 0xB4, 0x23, 0x99, 0x60, 0x05, 0x44,
+    0x98, 0x70, 0x04, 0x28, 0xB6, 0x21, 0x60, 0x15, 0x32, 0x00, 0x30, 0x06, 0x58, 0xA2, 0x27, 0x05,
+    0x84, 0x84, 0x90, 0x07, 0x39, 0xA6, 0x58, 0x80, 0x26, 0x18, 0x85, 0x84, 0x26, 0x81, 0x76, 0x93,
+    0x16, 0x14, 0x00, 0x75, 0x22, 0x43, 0x14, 0x88, 0x83, 0x12, 0x93, 0x06, 0x2B, 0xB6, 0x18, 0x06,
+    0x85, 0x1C, 0xB6, 0x06, 0x4C, 0x49, 0xE3, 0x15, 0x48, 0x53, 0x70, 0x02, 0x12, 0x02, 0x48, 0x02,
+    0x48, 0x12, 0x23, 0x12, 0x91, 0x11, 0xA0, 0x02, 0x48, 0x02, 0x48, 0x02, 0x19, 0x11, 0xA0, 0x12,
+    0x44, 0x02, 0x14, 0x11, 0xA0, 0x12, 0x74, 0x12, 0x48, 0x12, 0x48, 0x12, 0x65, 0x12, 0x91, 0x02,
+    0x17, 0x12, 0x11, 0x04, 0x66, 0x66, 0x12, 0xBB, 0x04, 0x66, 0x66, 0x12, 0x11, 0x31, 0x80, 0x31,
+    0xB0, 0x06, 0x28, 0x8D, 0x88, 0x06, 0x14, 0x4C, 0x44, 0x31, 0xB0, 0x31, 0x60, 0x11, 0x60, 0x02,
+    0x19, 0x02, 0x23, 0x03, 0x6B, 0x60, 0x01, 0x60, 0x01, 0x60, 0x21, 0x30, 0x12, 0x48, 0x12, 0x83,
+    0x11, 0xC0, 0x02, 0x39, 0x02, 0x75, 0x02, 0xC1, 0x01, 0x30, 0x13, 0x14, 0x10, 0x05, 0x1D, 0x8D,
+    0x10, 0x05, 0x66, 0x06, 0x60, 0x05, 0x84, 0x04, 0x80, 0x05, 0x75, 0x05, 0x70, 0x05, 0x2C, 0x4C,
+    0x20, 0x13, 0x48, 0x40, 0x12, 0x24, 0x03, 0x39, 0xD0, 0x21, 0xB0, 0x21, 0xB0, 0x21, 0xB0, 0x14,
+    0x4C, 0x41, 0x14, 0x88, 0x82, 0x12, 0x44, 0x05, 0x68, 0x8C, 0x10, 0x32, 0x84, 0x22, 0x3B, 0x13,
+    0x3B, 0x10, 0x05, 0x3D, 0x54, 0x10, 0x05, 0x48, 0x88, 0x20, 0x12, 0x34, 0x04, 0x38, 0x8B, 0x22,
+    0x1B, 0x13, 0x6C, 0x90, 0x32, 0x83, 0x05, 0x44, 0x5B, 0x20, 0x04, 0x28, 0x82, 0x31, 0x40, 0x22,
+    0x8D, 0x13, 0x38, 0xB0, 0x13, 0x90, 0xB0, 0x05, 0x7A, 0x8D, 0x60, 0x05, 0x24, 0x4C, 0x30, 0x31,
+    0x60, 0x04, 0x14, 0x43, 0x04, 0x4B, 0x86, 0x03, 0x49, 0x40, 0x04, 0x38, 0x8B, 0x32, 0x84, 0x05,
+    0x44, 0x5B, 0x10, 0x04, 0x28, 0x82, 0x22, 0x43, 0x13, 0xB8, 0x80, 0x02, 0x68, 0x05, 0x8B, 0xBB,
+    0x20, 0x05, 0x78, 0x05, 0x80, 0x05, 0x2C, 0x49, 0x50, 0x13, 0x48, 0x50, 0x05, 0x24, 0x44, 0x10,
+    0x05, 0x48, 0x8E, 0x20, 0x22, 0x2A, 0x22, 0x85, 0x21, 0xC0, 0x12, 0x67, 0x12, 0x51, 0x13, 0x14,
+    0x10, 0x05, 0x2C, 0x8C, 0x20, 0x05, 0x39, 0x09, 0x30, 0x05, 0x1A, 0xBA, 0x10, 0x05, 0x75, 0x05,
+    0x70, 0x05, 0x69, 0x49, 0x60, 0x13, 0x68, 0x60, 0x13, 0x14, 0x10, 0x05, 0x3B, 0x8C, 0x10, 0x05,
+    0x84, 0x08, 0x60, 0x05, 0x4C, 0x8D, 0x80, 0x14, 0x24, 0x77, 0x14, 0x55, 0xC1, 0x13, 0x78, 0x20,
+    0x01, 0x80, 0x01, 0x30, 0x00, 0x01, 0x60, 0x01, 0x60, 0x11, 0x80, 0x11, 0x30, 0x00, 0x11, 0x60,
+    0x02, 0x19, 0x02, 0x23, 0x51, 0x10, 0x24, 0x17, 0xB8, 0x05, 0x2A, 0xA6, 0x10, 0x05, 0x17, 0xB9,
+    0x40, 0x33, 0x38, 0x80, 0x06, 0x14, 0x44, 0x43, 0x06, 0x28, 0x88, 0x86, 0x06, 0x28, 0x88, 0x86,
+    0x06, 0x14, 0x44, 0x43, 0x01, 0x10, 0x04, 0x2B, 0x94, 0x24, 0x38, 0xB7, 0x15, 0x17, 0xB9, 0x40,
+    0x04, 0x3A, 0x61, 0x12, 0x33, 0x04, 0x68, 0xA5, 0x22, 0x57, 0x12, 0x39, 0x12, 0x84, 0x12, 0x42,
+    0x12, 0x42, 0x32, 0x34, 0x16, 0x3C, 0x88, 0xC6, 0x08, 0x1B, 0x27, 0x46, 0xA2, 0x08, 0x76, 0x97,
+    0x7B, 0x48, 0x08, 0x84, 0xB1, 0x1B, 0x66, 0x07, 0x58, 0x5C, 0x9E, 0x80, 0x16, 0x98, 0x10, 0x72,
+    0x24, 0x6B, 0xA5, 0x21, 0x30, 0x13, 0x2E, 0x60, 0x13, 0x87, 0xB0, 0x14, 0xC0, 0xA2, 0x05, 0x4E,
+    0xBD, 0x80, 0x05, 0x93, 0x00, 0xC0, 0x06, 0x60, 0x00, 0x51, 0x04, 0x14, 0x43, 0x05, 0x4B, 0x89,
+    0x80, 0x05, 0x48, 0x02, 0xA0, 0x05, 0x4D, 0xBC, 0x60, 0x05, 0x48, 0x00, 0xB0, 0x05, 0x49, 0x45,
+    0xC0, 0x05, 0x28, 0x87, 0x20, 0x23, 0x24, 0x20, 0x15, 0x99, 0x8A, 0x30, 0x02, 0x68, 0x02, 0x84,
+    0x02, 0x76, 0x06, 0x1B, 0x64, 0x73, 0x14, 0x17, 0x85, 0x04, 0x14, 0x43, 0x06, 0x4B, 0x89, 0xB1,
+    0x06, 0x48, 0x00, 0x49, 0x06, 0x48, 0x00, 0x0B, 0x06, 0x48, 0x00, 0x2A, 0x06, 0x49, 0x45, 0xB4,
+    0x05, 0x28, 0x87, 0x20, 0x05, 0x14, 0x44, 0x20, 0x05, 0x4B, 0x88, 0x40, 0x02, 0x48, 0x05, 0x4D,
+    0xBB, 0x30, 0x02, 0x48, 0x05, 0x49, 0x44, 0x20, 0x05, 0x28, 0x88, 0x40, 0x04, 0x14, 0x44, 0x04,
+    0x4B, 0x88, 0x02, 0x48, 0x04, 0x4D, 0xB8, 0x02, 0x48, 0x02, 0x48, 0x02, 0x24, 0x23, 0x34, 0x10,
+    0x15, 0x99, 0x8A, 0x30, 0x02, 0x68, 0x06, 0x84, 0x06, 0xB6, 0x06, 0x76, 0x00, 0x48, 0x06, 0x1B,
+    0x64, 0x87, 0x14, 0x17, 0x85, 0x06, 0x12, 0x00, 0x21, 0x06, 0x48, 0x00, 0x84, 0x06, 0x48, 0x00,
+    0x84, 0x06, 0x4D, 0xBB, 0xD4, 0x06, 0x48, 0x00, 0x84, 0x06, 0x48, 0x00, 0x84, 0x06, 0x24, 0x00,
+    0x42, 0x02, 0x12, 0x02, 0x48, 0x02, 0x48, 0x02, 0x48, 0x02, 0x48, 0x02, 0x48, 0x02, 0x24, 0x12,
+    0x12, 0x12, 0x48, 0x12, 0x48, 0x12, 0x48, 0x12, 0x48, 0x12, 0x48, 0x12, 0x58, 0x03, 0x6C, 0x20,
+    0x05, 0x12, 0x00, 0x40, 0x05, 0x48, 0x19, 0x60, 0x04, 0x48, 0xC6, 0x03, 0x4E, 0x80, 0x04, 0x48,
+    0x96, 0x05, 0x48, 0x09, 0x60, 0x06, 0x24, 0x00, 0x71, 0x02, 0x12, 0x02, 0x48, 0x02, 0x48, 0x02,
+    0x48, 0x02, 0x48, 0x05, 0x49, 0x44, 0x20, 0x05, 0x28, 0x88, 0x40, 0x06, 0x14, 0x00, 0x14, 0x06,
+    0x4E, 0x50, 0x8E, 0x06, 0x49, 0xA0, 0xCB, 0x06, 0x48, 0xB6, 0x8B, 0x06, 0x48, 0x6D, 0x2B, 0x06,
+    0x48, 0x17, 0x0B, 0x06, 0x24, 0x00, 0x06, 0x06, 0x14, 0x00, 0x21, 0x06, 0x4F, 0x40, 0x84, 0x06,
+    0x49, 0xA0, 0x84, 0x06, 0x48, 0x86, 0x84, 0x06, 0x48, 0x1B, 0x84, 0x06, 0x48, 0x06, 0xE4, 0x06,
+    0x24, 0x00, 0x82, 0x23, 0x34, 0x10, 0x15, 0x99, 0x8C, 0x30, 0x06, 0x68, 0x00, 0x1B, 0x06, 0x84,
+    0x00, 0x0B, 0x06, 0x66, 0x00, 0x0B, 0x06, 0x1B, 0x64, 0xA6, 0x14, 0x17, 0x84, 0x04, 0x14, 0x42,
+    0x05, 0x4B, 0x8C, 0x40, 0x05, 0x48, 0x04, 0x80, 0x05, 0x4B, 0x8C, 0x40, 0x04, 0x49, 0x42, 0x02,
+    0x48, 0x02, 0x24, 0x23, 0x34, 0x10, 0x15, 0x99, 0x8C, 0x30, 0x06, 0x68, 0x00, 0x1C, 0x06, 0x84,
+    0x00, 0x0B, 0x06, 0x66, 0x00, 0x0B, 0x06, 0x1B, 0x64, 0xA6, 0x14, 0x17, 0x8B, 0x42, 0x53, 0x04,
+    0x14, 0x42, 0x05, 0x4B, 0x8C, 0x40, 0x05, 0x48, 0x05, 0x80, 0x05, 0x4D, 0xBC, 0x20, 0x05, 0x48,
+    0x09, 0x40, 0x05, 0x48, 0x01, 0xB0, 0x06, 0x24, 0x00, 0x61, 0x13, 0x14, 0x30, 0x05, 0x4C, 0x88,
+    0x30, 0x02, 0x85, 0x05, 0x1A, 0xB8, 0x10, 0x32, 0x87, 0x05, 0x44, 0x49, 0x60, 0x04, 0x28, 0x85,
+    0x05, 0x44, 0x44, 0x30, 0x05, 0x88, 0xD8, 0x60, 0x21, 0xB0, 0x21, 0xB0, 0x21, 0xB0, 0x21, 0xB0,
+    0x21, 0x60, 0x06, 0x12, 0x00, 0x21, 0x06, 0x48, 0x00, 0x84, 0x06, 0x48, 0x00, 0x84, 0x06, 0x48,
+    0x00, 0x84, 0x06, 0x48, 0x00, 0x84, 0x06, 0x1C, 0x55, 0xC1, 0x14, 0x28, 0x82, 0x06, 0x30, 0x00,
+    0x21, 0x05, 0xA2, 0x00, 0xC0, 0x05, 0x67, 0x03, 0x90, 0x14, 0xC0, 0x93, 0x13, 0x83, 0xC0, 0x13,
+    0x3D, 0x70, 0x22, 0x71, 0x08, 0x30, 0x02, 0x20, 0x03, 0x08, 0x83, 0x0B, 0xB0, 0x48, 0x08, 0x58,
+    0x0B, 0xB0, 0x85, 0x08, 0x1B, 0x48, 0x84, 0xB1, 0x16, 0xC8, 0x44, 0x8C, 0x16, 0x8F, 0x00, 0xF8,
+    0x16, 0x26, 0x00, 0x62, 0x05, 0x22, 0x00, 0x40, 0x05, 0x1C, 0x17, 0x80, 0x13, 0x5A, 0xB0, 0x22,
+    0xD6, 0x14, 0x78, 0xC1, 0x05, 0x2B, 0x05, 0x80, 0x06, 0x53, 0x00, 0x71, 0x05, 0x40, 0x01, 0x30,
+    0x05, 0x87, 0x0A, 0x40, 0x13, 0xB7, 0x80, 0x13, 0x3D, 0x10, 0x21, 0xB0, 0x21, 0xB0, 0x21, 0x60,
+    0x05, 0x34, 0x44, 0x40, 0x05, 0x68, 0x8A, 0xC0, 0x23, 0x1C, 0x20, 0x22, 0xC3, 0x12, 0x96, 0x05,
+    0x6C, 0x44, 0x40, 0x05, 0x68, 0x88, 0x80, 0x03, 0x28, 0x40, 0x03, 0x49, 0x20, 0x02, 0x48, 0x02,
+    0x48, 0x02, 0x48, 0x02, 0x48, 0x02, 0x48, 0x03, 0x3B, 0x60, 0x01, 0x30, 0x02, 0xC1, 0x02, 0x75,
+    0x02, 0x39, 0x11, 0xC0, 0x12, 0x83, 0x12, 0x48, 0x21, 0x30, 0x03, 0x28, 0x40, 0x03, 0x17, 0x80,
+    0x12, 0x48, 0x12, 0x48, 0x12, 0x48, 0x12, 0x48, 0x12, 0x48, 0x03, 0x3B, 0x60, 0x22, 0x13, 0x14,
+    0x1B, 0xA6, 0x06, 0x1B, 0x30, 0x96, 0x04, 0x44, 0x44, 0x04, 0x88, 0x88, 0x02, 0x19, 0x12, 0x23,
+    0x04, 0x3B, 0xB9, 0x14, 0x24, 0xA3, 0x05, 0x5B, 0x8B, 0x40, 0x05, 0x78, 0x5C, 0x40, 0x14, 0x77,
+    0x52, 0x02, 0x24, 0x02, 0x48, 0x05, 0x4C, 0xBC, 0x30, 0x05, 0x49, 0x02, 0xA0, 0x05, 0x48, 0x00,
+    0xB0, 0x05, 0x4D, 0x58, 0x80, 0x04, 0x25, 0x76, 0x04, 0x1A, 0xBC, 0x02, 0x77, 0x02, 0x84, 0x04,
+    0x4C, 0x46, 0x13, 0x38, 0x70, 0x32, 0x24, 0x32, 0x48, 0x05, 0x1B, 0xBB, 0x80, 0x05, 0x76, 0x06,
+    0x80, 0x05, 0x84, 0x04, 0x80, 0x05, 0x4B, 0x4B, 0x80, 0x14, 0x48, 0x44, 0x05, 0x1B, 0xBA, 0x10,
+    0x05, 0x68, 0x48, 0x70, 0x05, 0x89, 0x88, 0x40, 0x05, 0x4B, 0x46, 0x30, 0x13, 0x48, 0x60, 0x12,
+    0x68, 0x03, 0x4A, 0x40, 0x03, 0xCD, 0x80, 0x02, 0x48, 0x02, 0x48, 0x02, 0x48, 0x02, 0x24, 0x05,
+    0x1B, 0xBB, 0x80, 0x05, 0x76, 0x06, 0x80, 0x05, 0x84, 0x04, 0x80, 0x05, 0x4B, 0x4B, 0x80, 0x14,
+    0x48, 0x78, 0x14, 0x98, 0xC2, 0x13, 0x34, 0x10, 0x02, 0x24, 0x02, 0x48, 0x05, 0x4C, 0xBD, 0x20,
+    0x05, 0x49, 0x05, 0x80, 0x05, 0x48, 0x04, 0x80, 0x05, 0x48, 0x04, 0x80, 0x05, 0x24, 0x02, 0x40,
+    0x02, 0x24, 0x02, 0x24, 0x02, 0x48, 0x02, 0x48, 0x02, 0x48, 0x02, 0x48, 0x02, 0x24, 0x12, 0x24,
+    0x12, 0x24, 0x12, 0x48, 0x12, 0x48, 0x12, 0x48, 0x12, 0x48, 0x12, 0x48, 0x03, 0x2A, 0x60, 0x02,
+    0x13, 0x02, 0x24, 0x02, 0x48, 0x05, 0x48, 0x3B, 0x30, 0x04, 0x4A, 0xB3, 0x03, 0x4C, 0x90, 0x04,
+    0x48, 0x69, 0x05, 0x24, 0x05, 0x40, 0x02, 0x24, 0x02, 0x48, 0x02, 0x48, 0x02, 0x48, 0x02, 0x48,
+    0x02, 0x48, 0x02, 0x24, 0x07, 0x4C, 0xAC, 0x7C, 0x80, 0x07, 0x49, 0x08, 0x60, 0xC0, 0x07, 0x48,
+    0x08, 0x40, 0xB0, 0x07, 0x48, 0x08, 0x40, 0xB0, 0x07, 0x24, 0x04, 0x20, 0x60, 0x05, 0x4C, 0xBD,
+    0x20, 0x05, 0x49, 0x05, 0x80, 0x05, 0x48, 0x04, 0x80, 0x05, 0x48, 0x04, 0x80, 0x05, 0x24, 0x02,
+    0x40, 0x05, 0x1B, 0xBB, 0x10, 0x05, 0x76, 0x06, 0x70, 0x05, 0x84, 0x04, 0x80, 0x05, 0x4B, 0x4B,
+    0x40, 0x13, 0x48, 0x40, 0x05, 0x4C, 0xBC, 0x30, 0x05, 0x49, 0x02, 0xA0, 0x05, 0x48, 0x00, 0xB0,
+    0x05, 0x4D, 0x58, 0x80, 0x04, 0x48, 0x76, 0x02, 0x48, 0x02, 0x12, 0x05, 0x1B, 0xBB, 0x80, 0x05,
+    0x76, 0x06, 0x80, 0x05, 0x84, 0x04, 0x80, 0x05, 0x4B, 0x4B, 0x80, 0x14, 0x48, 0x68, 0x32, 0x48,
+    0x32, 0x12, 0x04, 0x4C, 0xB3, 0x02, 0x49, 0x02, 0x48, 0x02, 0x48, 0x02, 0x24, 0x04, 0x4C, 0xB6,
+    0x03, 0x79, 0x40, 0x13, 0x58, 0x80, 0x04, 0x55, 0x5A, 0x04, 0x17, 0x71, 0x02, 0x12, 0x02, 0x48,
+    0x03, 0x9D, 0xB0, 0x02, 0x48, 0x02, 0x48, 0x03, 0x3A, 0x40, 0x12, 0x68, 0x05, 0x48, 0x04, 0x80,
+    0x05, 0x48, 0x04, 0x80, 0x05, 0x48, 0x04, 0x80, 0x05, 0x2C, 0x4B, 0x80, 0x14, 0x58, 0x44, 0x05,
+    0x83, 0x07, 0x50, 0x04, 0x39, 0x0C, 0x13, 0xC3, 0x90, 0x13, 0x7C, 0x30, 0x12, 0x28, 0x06, 0x92,
+    0x8B, 0x0B, 0x06, 0x66, 0xBA, 0x39, 0x06, 0x2A, 0xA7, 0xA6, 0x15, 0xD7, 0x3F, 0x20, 0x14, 0x62,
+    0x08, 0x05, 0x3B, 0x0C, 0x30, 0x13, 0x7D, 0x70, 0x13, 0x4F, 0x30, 0x04, 0x1C, 0x3B, 0x05, 0x53,
+    0x05, 0x30, 0x05, 0x84, 0x08, 0x50, 0x04, 0x2A, 0x0C, 0x13, 0xA7, 0x80, 0x13, 0x5E, 0x20, 0x12,
+    0x1B, 0x03, 0x2A, 0x60, 0x02, 0x13, 0x04, 0x8B, 0xDA, 0x13, 0x1B, 0x30, 0x12, 0xA5, 0x04, 0x8A,
+    0x43, 0x04, 0x68, 0x86, 0x13, 0x28, 0x20, 0x13, 0xA5, 0x10, 0x11, 0xB0, 0x02, 0x4C, 0x02, 0x89,
+    0x11, 0xB0, 0x11, 0xB0, 0x13, 0x7C, 0x30, 0x01, 0x60, 0x01, 0xB0, 0x01, 0xB0, 0x01, 0xB0, 0x01,
+    0xB0, 0x01, 0xB0, 0x01, 0xB0, 0x01, 0xB0, 0x01, 0x60, 0x02, 0x84, 0x02, 0x4C, 0x11, 0xB0, 0x13,
+    0xA5, 0x10, 0x13, 0x78, 0x20, 0x11, 0xB0, 0x11, 0xB0, 0x02, 0xBA, 0x06, 0x19, 0xB7, 0x47, 0x06,
+    0x22, 0x16, 0x82, 0x12, 0x22, 0x04, 0x28, 0x82, 0x04, 0x28, 0x82, 0x12, 0x22, 0x23, 0x24, 0x20,
+    0x15, 0x99, 0x8A, 0x30, 0x02, 0x68, 0x02, 0x84, 0x02, 0x76, 0x06, 0x1B, 0x64, 0x73, 0x14, 0x17,
+    0xC5, 0x22, 0x4C, 0x23, 0x86, 0x30, 0x23, 0x34, 0x10, 0x15, 0x99, 0x8C, 0x30, 0x06, 0x68, 0x00,
+    0x1B, 0x06, 0x84, 0x00, 0x0B, 0x06, 0x66, 0x00, 0x0B, 0x06, 0x1B, 0x64, 0xA6, 0x14, 0x17, 0x84,
+    0x22, 0x88, 0x06, 0x12, 0x00, 0x21, 0x06, 0x48, 0x00, 0x84, 0x06, 0x48, 0x00, 0x84, 0x06, 0x48,
+    0x00, 0x84, 0x06, 0x48, 0x00, 0x84, 0x06, 0x1C, 0x55, 0xC1, 0x14, 0x28, 0x82, 0x04, 0x1A, 0xBC,
+    0x02, 0x77, 0x02, 0x84, 0x04, 0x4C, 0x46, 0x13, 0x3C, 0x80, 0x13, 0x3B, 0x30, 0x13, 0x44, 0x40,
+    0x13, 0x22, 0x20, 0x05, 0x1B, 0xBB, 0x10, 0x05, 0x76, 0x06, 0x70, 0x05, 0x84, 0x04, 0x80, 0x05,
+    0x4B, 0x4B, 0x40, 0x13, 0x48, 0x40, 0x13, 0x42, 0x60, 0x13, 0x21, 0x30, 0x05, 0x48, 0x04, 0x80,
+    0x05, 0x48, 0x04, 0x80, 0x05, 0x48, 0x04, 0x80, 0x05, 0x2C, 0x4B, 0x80, 0x14, 0x58, 0x44, 0x14,
+    0x19, 0x92, 0x23, 0x34, 0x10, 0x15, 0x99, 0x8A, 0x30, 0x02, 0x68, 0x06, 0x84, 0x06, 0xB6, 0x06,
+    0x76, 0x00, 0x48, 0x06, 0x1B, 0x64, 0x87, 0x14, 0x17, 0x85, 0x13, 0x88, 0x80, 0x00, 0x05, 0x1B,
+    0xBB, 0x80, 0x05, 0x76, 0x06, 0x80, 0x05, 0x84, 0x04, 0x80, 0x05, 0x4B, 0x4B, 0x80, 0x14, 0x48,
+    0x78, 0x14, 0x98, 0xC2, 0x13, 0x34, 0x10, 0x02, 0x36, 0x02, 0x12, 0x02, 0x48, 0x02, 0x48, 0x02,
+    0x48, 0x02, 0x48, 0x02, 0x48, 0x02, 0x24, 0x02, 0x48, 0x02, 0x48, 0x02, 0x48, 0x02, 0x48, 0x02,
+    0x24, 0x13, 0x14, 0x30, 0x05, 0x4C, 0x88, 0x30, 0x02, 0x85, 0x05, 0x1A, 0xB8, 0x10, 0x32, 0x87,
+    0x05, 0x44, 0x49, 0x60, 0x04, 0x28, 0xC6, 0x13, 0x3B, 0x30, 0x04, 0x4C, 0xB6, 0x03, 0x79, 0x40,
+    0x13, 0x58, 0x80, 0x04, 0x55, 0x5A, 0x04, 0x17, 0xB1, 0x12, 0x7A,
+};
+
+const ssd1322_aa_font_t FontAA_Sans8 = {
+    FontAA_Sans8_codes, FontAA_Sans8_glyphs, FontAA_Sans8_atlas,
+    108, 10, 8, 0x003F,
+};
@@ -0,0 +1,44 @@
+/* host/hal_host.c - Linux HAL karşılığı */
+
+#define _POSIX_C_SOURCE 200809L
+#include <time.h>
+#include "stm32h7xx_hal.h"
+
+GPIO_TypeDef hal_host_gpioa, hal_host_gpiob;
+
+void (*hal_host_spi_sink)(int dc, const uint8_t *data, uint16_t len);
+int  (*hal_host_spi_fail)(const uint8_t *data, uint16_t len);
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state)
+{
+    if (state == GPIO_PIN_SET) port->odr |= pin;
+    else                       port->odr &= ~(uint32_t)pin;
+}
+
+void HAL_GPIO_TogglePin(GPIO_TypeDef *port, uint16_t pin)
+{
+    port->odr ^= pin;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *data, uint16_t len, uint32_t timeout)
+{
+    (void)hspi;
+    (void)timeout;
+    if (hal_host_spi_fail && hal_host_spi_fail(data, len)) return HAL_ERROR;
+    if (hal_host_spi_sink)
+        hal_host_spi_sink((hal_host_gpioa.odr & GPIO_PIN_9) != 0, data, len);   // DC = PA9
+    return HAL_OK;
+}
+
+void HAL_Delay(uint32_t ms)
+{
+    struct timespec ts = { (time_t)(ms / 1000u), (long)(ms % 1000u) * 1000000L };
+    nanosleep(&ts, NULL);
+}
+
+uint32_t HAL_GetTick(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000u + (uint32_t)(ts.tv_nsec / 1000000L));
+}
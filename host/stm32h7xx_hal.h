@@ -0,0 +1,45 @@
+/* host/stm32h7xx_hal.h - Linux derlemesi için minimal HAL karşılığı
+ *
+ * Sürücüyü (oled_*.c) PC'de derlemek için include yolunda gerçek HAL'in
+ * önüne konur: gcc -Ihost -I. ...
+ * SPI'a giden her byte hal_host_spi_sink'e verilir (dc = 1 veri, 0 komut).
+ * DMA yok: host derlemelerinde SSD1322_USE_DMA tanımlanmamalıdır.
+ * hal_host_spi_fail ile transfer hataları (kopuk kablo vb.) denenebilir.
+ */
+
+#ifndef HOST_STM32H7XX_HAL_H
+#define HOST_STM32H7XX_HAL_H
+
+#include <stdint.h>
+
+typedef enum { HAL_OK = 0, HAL_ERROR, HAL_BUSY, HAL_TIMEOUT } HAL_StatusTypeDef;
+typedef enum { GPIO_PIN_RESET = 0, GPIO_PIN_SET } GPIO_PinState;
+
+typedef struct { uint32_t odr; } GPIO_TypeDef;
+typedef struct { uint32_t id; } SPI_HandleTypeDef;
+
+extern GPIO_TypeDef hal_host_gpioa, hal_host_gpiob;
+#define GPIOA (&hal_host_gpioa)
+#define GPIOB (&hal_host_gpiob)
+
+#define GPIO_PIN_2   ((uint16_t)0x0004)
+#define GPIO_PIN_8   ((uint16_t)0x0100)
+#define GPIO_PIN_9   ((uint16_t)0x0200)
+#define GPIO_PIN_10  ((uint16_t)0x0400)
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state);
+void HAL_GPIO_TogglePin(GPIO_TypeDef *port, uint16_t pin);
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *data, uint16_t len, uint32_t timeout);
+void HAL_Delay(uint32_t ms);
+uint32_t HAL_GetTick(void);
+
+static inline void __disable_irq(void) { }
+static inline void __enable_irq(void)  { }
+
+/* SPI çıkışı: dc = DC pininin o anki seviyesi */
+extern void (*hal_host_spi_sink)(int dc, const uint8_t *data, uint16_t len);
+
+/* Hata enjeksiyonu: sıfırdan farklıysa transfer HAL_ERROR döner (sink'e gitmez) */
+extern int (*hal_host_spi_fail)(const uint8_t *data, uint16_t len);
+
+#endif /* HOST_STM32H7XX_HAL_H */
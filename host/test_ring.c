@@ -0,0 +1,204 @@
+/* host/test_ring.c - oled_ring / oled_remote iki thread testi (Linux)
+ *
+ * Derleme:  gcc -std=c11 -O2 -pthread -Ihost -I. -o test_ring host/test_ring.c host/hal_host.c \
+ *               oled_ring.c oled_remote.c oled_remote_render.c oled_ssd1322.c oled_font.c \
+ *               font6x8.c font6x8_tr.c oled_sprite.c
+ * Çalıştırma: ./test_ring [kayıt sayısı]
+ *
+ * İki thread iki çekirdeğin yerine geçer:
+ *   1. Ham halka: üretici değişken uzunlukta kayıtlar yazar (sıra numarası +
+ *      numaradan türeyen desen), tüketici sırayı ve içeriği byte byte doğrular.
+ *   2. Remote: üretici (M7) çizim komutları ve sıra numaralı NOP (0xE3)
+ *      komutları gönderir, tüketici (M4) SSD1322_Remote_Service ile işler;
+ *      SPI'a çıkan NOP'lar sıra ve içerik için denetlenir.
+ * Her iki bölüm de saniyedeki kayıt / komut sayısını yazar. Hata varsa 1 döner.
+ * Bekleyen taraf sched_yield ile bırakır (tek çekirdekli makinede de çalışsın).
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <sched.h>
+#include "oled_ring.h"
+#include "oled_remote.h"
+
+SPI_HandleTypeDef hspi2;
+
+#define NOP_CMD 0xE3
+
+static long n_records = 2000000;
+static atomic_int errors;
+
+static double now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* Kayıt i: uzunluk 4..63, payload[0..3] = i, sonrası i'den türeyen desen */
+static uint16_t rec_len(uint32_t i)
+{
+    return (uint16_t)(4 + (i * 2654435761u >> 26));
+}
+
+static uint8_t rec_byte(uint32_t i, int k)
+{
+    return (uint8_t)(i * 31u + (uint32_t)k * 7u);
+}
+
+static void fail(const char *what, long i)
+{
+    if (atomic_fetch_add(&errors, 1) < 10) fprintf(stderr, "test_ring: %s (kayıt %ld)\n", what, i);
+}
+
+/* --- 1. ham halka --- */
+
+static ssd1322_ring_t ring;
+
+static void *raw_producer(void *arg)
+{
+    (void)arg;
+    for (uint32_t i = 0; i < (uint32_t)n_records; i++) {
+        uint16_t len = rec_len(i);
+        uint8_t *p;
+        while ((p = SSD1322_Ring_Reserve(&ring, (uint8_t)(i % 200), (uint8_t)(i >> 8), len)) == NULL) sched_yield();
+        memcpy(p, &i, 4);
+        for (int k = 4; k < len; k++) p[k] = rec_byte(i, k);
+        SSD1322_Ring_Commit(&ring);
+    }
+    return NULL;
+}
+
+static void test_raw(void)
+{
+    pthread_t t;
+    long bytes = 0;
+    double t0 = now_s();
+
+    SSD1322_Ring_Init(&ring);
+    pthread_create(&t, NULL, raw_producer, NULL);
+    for (uint32_t i = 0; i < (uint32_t)n_records; i++) {
+        const ssd1322_ring_hdr_t *h;
+        while ((h = SSD1322_Ring_Peek(&ring)) == NULL) sched_yield();
+        const uint8_t *p = (const uint8_t *)(h + 1);
+        uint32_t seq;
+        memcpy(&seq, p, 4);
+        if (h->op != i % 200 || h->arg != (uint8_t)(i >> 8) || h->len != rec_len(i)) fail("başlık bozuk", i);
+        else if (seq != i) fail("sıra bozuk", i);
+        else
+            for (int k = 4; k < h->len; k++)
+                if (p[k] != rec_byte(i, k)) { fail("payload bozuk", i); break; }
+        bytes += h->len;
+        SSD1322_Ring_Release(&ring);
+    }
+    pthread_join(t, NULL);
+    if (SSD1322_Ring_Peek(&ring)) fail("fazla kayıt", n_records);
+
+    double dt = now_s() - t0;
+    printf("halka:  %ld kayıt, %.1f M kayıt/s, %.1f MB/s payload\n",
+           n_records, n_records / dt * 1e-6, bytes / dt * 1e-6);
+}
+
+/* --- 2. remote (M7 -> M4) --- */
+
+static uint32_t nop_expect;          // sıradaki NOP numarası (M4 thread'i)
+static int      sink_cmd = -1;
+static uint8_t  sink_buf[64];
+static int      sink_n;
+static long     spi_bytes;
+
+static void check_nop(void)
+{
+    uint32_t seq;
+    if (sink_n < 4) { fail("NOP kısa", (long)nop_expect); return; }
+    memcpy(&seq, sink_buf, 4);
+    if (seq != nop_expect) { fail("NOP sırası bozuk", (long)nop_expect); nop_expect = seq; }
+    if (sink_n != 4 + (int)(seq % 8)) fail("NOP uzunluğu bozuk", (long)seq);
+    for (int k = 4; k < sink_n; k++)
+        if (sink_buf[k] != rec_byte(seq, k)) { fail("NOP içeriği bozuk", (long)seq); break; }
+    nop_expect++;
+}
+
+static void sink(int dc, const uint8_t *d, uint16_t n)
+{
+    spi_bytes += n;
+    if (!dc) {
+        if (sink_cmd == NOP_CMD) check_nop();
+        sink_cmd = d[n - 1];
+        sink_n = 0;
+        return;
+    }
+    if (sink_cmd == NOP_CMD)
+        for (int i = 0; i < n && sink_n < (int)sizeof(sink_buf); i++) sink_buf[sink_n++] = d[i];
+}
+
+static long n_commands;
+
+static void *m7_producer(void *arg)
+{
+    (void)arg;
+    char text[24];
+    uint8_t data[12];
+    for (uint32_t i = 0; i < (uint32_t)n_records / 4; i++) {
+        memcpy(data, &i, 4);
+        for (int k = 4; k < 12; k++) data[k] = rec_byte(i, k);
+        while (!SSD1322_Remote_Command(NOP_CMD, data, (uint16_t)(4 + i % 8))) sched_yield();
+        while (!SSD1322_Remote_SetPixel((int)(i % 128), (int)(i % 64), (uint8_t)(i & 3))) sched_yield();
+        if (i % 16 == 0) {
+            snprintf(text, sizeof(text), "%lu", (unsigned long)i);
+            while (!SSD1322_Remote_DrawCenteredAtY(text, (int)(i % 56))) sched_yield();
+            n_commands++;
+        }
+        if (i % 4096 == 0) {
+            while (!SSD1322_Remote_Present()) sched_yield();
+            n_commands++;
+        }
+        n_commands += 2;
+    }
+    return NULL;
+}
+
+static void test_remote(void)
+{
+    pthread_t t;
+    long served = 0;
+    uint32_t nops = (uint32_t)n_records / 4;
+    double t0 = now_s();
+
+    hal_host_spi_sink = sink;
+    SSD1322_Remote_Init();
+    pthread_create(&t, NULL, m7_producer, NULL);
+    while (nop_expect < nops && atomic_load(&errors) < 10) {
+        int n = SSD1322_Remote_Service(0);
+        served += n;
+        if (!n) sched_yield();
+        if (sink_cmd == NOP_CMD && sink_n) {   // son komutun verisi tamam, bir sonraki komutu beklemeden denetle
+            check_nop();
+            sink_cmd = -1;
+        }
+    }
+    pthread_join(t, NULL);
+    served += SSD1322_Remote_Service(0);
+    if (served != n_commands) fail("işlenen komut sayısı tutmuyor", served);
+
+    double dt = now_s() - t0;
+    printf("remote: %ld komut, %.2f M komut/s, SPI %.1f MB/s\n",
+           served, served / dt * 1e-6, spi_bytes / dt * 1e-6);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1) n_records = atol(argv[1]);
+    if (n_records < 4) n_records = 4;
+
+    test_raw();
+    test_remote();
+
+    int e = atomic_load(&errors);
+    printf("%s (%d hata)\n", e ? "HATA" : "tamam", e);
+    return e != 0;
+}
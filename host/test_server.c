@@ -0,0 +1,132 @@
+/* host/test_server.c - display server kuyruğu stres testi (Linux)
+ *
+ * Derleme:  gcc -std=c11 -O2 -pthread -Ihost -I. -DSSD1322_SERVER_TEST -DSSD1322_SERVER_POS0=0xFFFFF000u \
+ *               -o test_server host/test_server.c host/hal_host.c oled_server.c \
+ *               oled_ssd1322.c oled_font.c font6x8.c font6x8_tr.c oled_text.c oled_sprite.c
+ *           (-fsanitize=thread ile de çalıştırılmalı)
+ * Çalıştırma: ./test_server [üretici başına istek]
+ *
+ * NT üretici thread'i kendi key'ine sıra numaralı CALL istekleri, ara sıra
+ * key'siz istekler gönderir; ana thread SSD1322_Server_Run ile tüketir.
+ * Denetlenenler:
+ *   - yırtılma: fn ve ctx aynı istekten gelmeli (thread numarası ikisinde de)
+ *   - sıra: bir key'de çalışan numaralar artan olmalı
+ *   - kayıp: her key'in son isteği çalışmalı, key'siz istekler hep çalışmalı
+ *   - sayaçlar: submitted = executed + coalesced
+ * Kuyruk 2^32 sarmasının hemen önünden başlar (SSD1322_SERVER_POS0). Ayrıca
+ * 2^31'den uzun süre boşta kalmış bir key'in yeni isteğinin birleştirilip
+ * düşmediği (SSD1322_Server_TestAgeKey) ve SPRITE isteğinin çağıranın
+ * tanımlayıcısını kopyaladığı denetlenir. Saniyedeki istek sayısı yazılır.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <sched.h>
+#include "oled_server.h"
+
+SPI_HandleTypeDef hspi2;
+
+#define NT       8
+#define KEY_IDLE 30
+
+static unsigned per_thread = 20000;
+static unsigned last[NT];
+static unsigned long torn, reordered, nokey_exec, idle_exec;
+static _Atomic unsigned long nokey_sent;
+
+static double now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void check(int t, void *ctx)
+{
+    uintptr_t v = (uintptr_t)ctx;
+    unsigned k = (unsigned)(v & 0xFFFFFF);
+    if ((int)(v >> 24) != t) torn++;
+    if (k <= last[t]) reordered++;
+    last[t] = k;
+}
+
+#define FN(i) static void f##i(void *ctx) { check(i, ctx); }
+FN(0) FN(1) FN(2) FN(3) FN(4) FN(5) FN(6) FN(7)
+static const ssd1322_server_fn fns[NT] = { f0, f1, f2, f3, f4, f5, f6, f7 };
+
+static void nokey(void *ctx) { (void)ctx; nokey_exec++; }
+static void idle(void *ctx)  { (void)ctx; idle_exec++; }
+
+static void *producer(void *arg)
+{
+    int t = (int)(intptr_t)arg;
+    for (unsigned k = 1; k <= per_thread; k++) {
+        while (!SSD1322_Server_Call((uint16_t)(t + 1), fns[t], (void *)(uintptr_t)((unsigned)t << 24 | k)))
+            sched_yield();
+        if (k % 16 == 0 && SSD1322_Server_Call(0, nokey, NULL))
+            atomic_fetch_add(&nokey_sent, 1);
+    }
+    return NULL;
+}
+
+int main(int argc, char **argv)
+{
+    int fails = 0;
+    if (argc > 1) per_thread = (unsigned)atoi(argv[1]);
+    if (per_thread < 1 || per_thread > 0xFFFFFF) per_thread = 20000;
+
+    SSD1322_Server_Init();
+
+    /* 2^31 + 5 gönderim boyunca boşta kalmış gibi: latest eski bir değerde */
+    SSD1322_Server_TestAgeKey(KEY_IDLE, 0x80000005u);
+    SSD1322_Server_Call(KEY_IDLE, idle, NULL);
+    SSD1322_Server_Run(0);
+    if (idle_exec != 1) { printf("boşta kalan key'in isteği düştü\n"); fails++; }
+
+    /* sprite: tanımlayıcı gönderimden sonra bozulsa da doğru çizilmeli */
+    {
+        static const uint8_t px[2] = { 0xE4, 0x1B };
+        ssd1322_sprite_t spr = { px, NULL, 0, 4, 2, 1, 0, SSD1322_SPRITE_2BPP, SSD1322_SPRITE_NO_KEY };
+        SSD1322_Server_Sprite(0, 10, 5, &spr);
+        memset(&spr, 0, sizeof(spr));
+        SSD1322_Server_Run(0);
+        if (framebuf[5][10] != 3 || framebuf[5][13] != 0 || framebuf[6][10] != 0 || framebuf[6][13] != 3) {
+            printf("sprite tanımlayıcısı kopyalanmadı\n");
+            fails++;
+        }
+    }
+
+    pthread_t th[NT];
+    double t0 = now_s();
+    for (int i = 0; i < NT; i++) pthread_create(&th[i], NULL, producer, (void *)(intptr_t)i);
+
+    for (;;) {
+        if (!SSD1322_Server_Run(0)) sched_yield();
+        int done = 1;
+        for (int i = 0; i < NT; i++) if (last[i] != per_thread) done = 0;
+        if (done) break;
+    }
+    for (int i = 0; i < NT; i++) pthread_join(th[i], NULL);
+    SSD1322_Server_Run(0);
+    double dt = now_s() - t0;
+
+    ssd1322_server_stats_t s;
+    SSD1322_Server_GetStats(&s);
+    printf("gönderilen %u, düşen %u, birleşen %u, çalışan %u\n", s.submitted, s.dropped, s.coalesced, s.executed);
+    printf("%d üretici: %.2f M istek/s (düşenler dahil %.2f M deneme/s)\n", NT,
+           s.submitted / dt * 1e-6, (s.submitted + s.dropped) / dt * 1e-6);
+    printf("yırtık %lu, sırasız %lu, key'siz %lu/%lu\n", torn, reordered, nokey_exec, atomic_load(&nokey_sent));
+
+    if (torn || reordered) fails++;
+    if (nokey_exec != atomic_load(&nokey_sent)) fails++;
+    if (s.submitted != s.executed + s.coalesced) fails++;
+    for (int i = 0; i < NT; i++)
+        if (last[i] != per_thread) { printf("key %d son istek çalışmadı (%u)\n", i + 1, last[i]); fails++; }
+
+    printf("%s\n", fails ? "HATA" : "tamam");
+    return fails != 0;
+}
@@ -0,0 +1,131 @@
+/* host/test_stack.c - oled_stack bellek / geri yükleme süresi ölçümü (Linux)
+ *
+ * Derleme:  gcc -std=c11 -O2 -Ihost -I. -o test_stack host/test_stack.c host/hal_host.c oled_stack.c \
+ *               oled_ssd1322.c oled_text.c oled_font.c font6x8.c font6x8_tr.c
+ * Çalıştırma: ./test_stack [tekrar]
+ *
+ * Menü benzeri ekranlar (başlık çubuğu + metin satırları) arena dolana kadar
+ * yığına atılır; her seviye için arena'da tutulan byte, ham framebuf'a (8192)
+ * ve 2bpp pakete (2048) oranı yazılır (arena -DSSD1322_STACK_ARENA ile
+ * büyütülebilir). Sonra seviyeler ters sırada açılır, framebuf'ın birebir
+ * geri geldiği denetlenir ve Pop süresi ölçülür (tekrar ortalamasıyla).
+ * Son olarak gürültülü (sıkışmayan) ekranların arena dolunca reddedildiği ve
+ * reddin arena'yı değiştirmediği denetlenir. Hata varsa 1 döner.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "oled_stack.h"
+#include "oled_text.h"
+
+SPI_HandleTypeDef hspi2;
+
+#define LEVELS 6
+
+static const char *titles[LEVELS] = { "Ayarlar", "Ekran", "Parlaklık", "Ağ", "Wi-Fi", "Gelişmiş" };
+static uint8_t saved[LEVELS][SSD1322_HEIGHT][SSD1322_WIDTH];
+static int errors;
+
+static double now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e6 + ts.tv_nsec * 1e-3;
+}
+
+static void fail(const char *what, int lvl)
+{
+    errors++;
+    fprintf(stderr, "test_stack: %s (seviye %d)\n", what, lvl);
+}
+
+/* Başlık çubuğu (ters renk) + dört menü satırı, seçili satır çerçeveli */
+static void draw_menu(int lvl)
+{
+    ssd1322_text_t t;
+    char line[40];
+
+    SSD1322_ClearFramebuffer();
+    SSD1322_FillRect(0, 0, SSD1322_WIDTH, 10, 3);
+    SSD1322_Text_Init(&t, titles[lvl], 0, 1, SSD1322_WIDTH, 8, SSD1322_TEXT_CENTER);
+    SSD1322_Text_Draw(&t);
+    for (int i = 0; i < 4; i++) {
+        snprintf(line, sizeof(line), "%d. %s öğe %d", i + 1, titles[(lvl + i) % LEVELS], i);
+        SSD1322_Text_Init(&t, line, 4, 14 + i * 12, 120, 10, 0);
+        SSD1322_Text_Draw(&t);
+    }
+    SSD1322_FillRect(0, 13 + (lvl % 4) * 12, 2, 10, 2);
+}
+
+int main(int argc, char **argv)
+{
+    int reps = argc > 1 ? atoi(argv[1]) : 1000;
+    if (reps < 1) reps = 1;
+
+    printf("seviye  byte  ham oranı  2bpp oranı  push us\n");
+    int depth = 0;
+    for (int lvl = 0; lvl < LEVELS; lvl++) {
+        draw_menu(lvl);
+        memcpy(saved[lvl], framebuf, sizeof(framebuf));
+        size_t free0 = SSD1322_Stack_Free();
+        double t0 = now_us();
+        if (!SSD1322_Stack_Push()) {     // arena doldu
+            if (!lvl) { fail("ilk push reddedildi", lvl); return 1; }
+            if (SSD1322_Stack_Free() != free0) fail("reddedilen push arena'yı değiştirdi", lvl);
+            break;
+        }
+        double dt = now_us() - t0;
+        depth++;
+        size_t b = SSD1322_Stack_Bytes(lvl);
+        printf("%6d %5zu %9.1f%% %10.1f%% %8.1f\n", lvl, b,
+               100.0 * b / sizeof(framebuf), 100.0 * b / (sizeof(framebuf) / 4), dt);
+    }
+    printf("arena: %u byte, boş %zu, derinlik %d\n",
+           (unsigned)SSD1322_STACK_ARENA, SSD1322_Stack_Free(), SSD1322_Stack_Depth());
+
+    /* geri yükleme: en üst seviye reps kez aç + tekrar at, sonra gerçek Pop */
+    for (int lvl = depth - 1; lvl >= 0; lvl--) {
+        double t0 = now_us();
+        for (int r = 0; r < reps; r++) {
+            SSD1322_ClearFramebuffer();
+            SSD1322_Stack_Pop();
+            SSD1322_Stack_Push();
+        }
+        double per = (now_us() - t0) / reps;
+
+        SSD1322_ClearFramebuffer();
+        double t1 = now_us();
+        if (!SSD1322_Stack_Pop()) fail("pop reddedildi", lvl);
+        double pop = now_us() - t1;
+        if (memcmp(saved[lvl], framebuf, sizeof(framebuf))) fail("geri yüklenen ekran farklı", lvl);
+        printf("pop %d: %.1f us (pop + push ortalaması %.1f us)\n", lvl, pop, per);
+    }
+    if (SSD1322_Stack_Depth() != 0 || SSD1322_Stack_Free() != SSD1322_STACK_ARENA) fail("yığın boşalmadı", 0);
+
+    /* sıkışmayan ekranlar: arena dolunca reddedilmeli, dolu seviyeler bozulmamalı */
+    srand(1);
+    int pushed = 0;
+    for (;;) {
+        for (int y = 0; y < SSD1322_HEIGHT; y++)
+            for (int x = 0; x < SSD1322_WIDTH; x++) framebuf[y][x] = (uint8_t)(rand() & 3);
+        if (pushed < LEVELS) memcpy(saved[pushed], framebuf, sizeof(framebuf));
+        size_t free0 = SSD1322_Stack_Free();
+        if (!SSD1322_Stack_Push()) {
+            if (SSD1322_Stack_Free() != free0) fail("reddedilen push arena'yı değiştirdi", pushed);
+            break;
+        }
+        if (++pushed > SSD1322_STACK_DEPTH) { fail("derinlik sınırı aşıldı", pushed); break; }
+    }
+    printf("gürültü: %d ekran sığdı (ekran başına ~%zu byte)\n", pushed,
+           pushed ? SSD1322_Stack_Bytes(0) : (size_t)0);
+    for (int lvl = pushed - 1; lvl >= 0; lvl--) {
+        if (!SSD1322_Stack_Pop()) fail("pop reddedildi", lvl);
+        else if (lvl < LEVELS && memcmp(saved[lvl], framebuf, sizeof(framebuf))) fail("gürültü ekranı farklı", lvl);
+    }
+
+    printf("%s (%d hata)\n", errors ? "HATA" : "tamam", errors);
+    return errors != 0;
+}
@@ -0,0 +1,164 @@
+/* oled_aafont.c */
+
+#include "oled_aafont.h"
+#include "oled_font.h"
+
+static const ssd1322_aa_font_t *cur_font = &FontAA_Sans8;
+
+void SSD1322_AA_SetFont(const ssd1322_aa_font_t *f)
+{
+    cur_font = f ? f : &FontAA_Sans8;
+}
+
+const ssd1322_aa_font_t *SSD1322_AA_GetFont(void)
+{
+    return cur_font;
+}
+
+const ssd1322_aa_glyph_t *SSD1322_AA_Glyph(const ssd1322_aa_font_t *f, uint32_t cp)
+{
+    int lo = 0, hi = f->count - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        if (f->codes[mid] == cp) return &f->glyphs[mid];
+        if (f->codes[mid] < cp) lo = mid + 1;
+        else                    hi = mid - 1;
+    }
+    return 0;
+}
+
+static const ssd1322_aa_glyph_t *glyph_or_fallback(const ssd1322_aa_font_t *f, uint32_t cp)
+{
+    const ssd1322_aa_glyph_t *g = SSD1322_AA_Glyph(f, cp);
+    return g ? g : SSD1322_AA_Glyph(f, f->fallback);
+}
+
+static inline uint8_t coverage(const uint8_t *cov, int i)
+{
+    return (uint8_t)((cov[i >> 1] >> ((i & 1) ? 0 : 4)) & 0x0F);
+}
+
+/* blend[hedef][kapsama], renk sabit */
+static void blend_table(uint8_t (*bt)[16], int levels, uint8_t gray)
+{
+    for (int d = 0; d < levels; d++)
+        for (int k = 0; k < 16; k++)
+            bt[d][k] = (uint8_t)((d * (15 - k) + gray * k + 7) / 15);
+}
+
+/* Satır başına: başlık, boş satırı atla, aralığı kırpıp tablo ile karıştır */
+static void draw_glyph(int x, int y, const ssd1322_aa_font_t *f,
+                       const ssd1322_aa_glyph_t *g, const uint8_t (*bt)[16])
+{
+    const ssd1322_surface_t *t = ssd1322_target;
+    const uint8_t *p = f->atlas + g->offset;
+    int gx = x + g->dx, gy = y + g->dy;
+
+    for (int r = 0; r < g->h; r++) {
+        uint8_t hdr = *p++;
+        int n = hdr & 0x0F;
+        const uint8_t *cov = p;
+        p += (n + 1) / 2;
+        if (!n) continue;
+
+        uint8_t *line = SSD1322_TargetRow(gy + r);
+        if (!line) continue;
+        int px = gx + (hdr >> 4);
+        int i0 = px < t->clip_x0 ? t->clip_x0 - px : 0;
+        int i1 = px + n - 1 > t->clip_x1 ? t->clip_x1 - px + 1 : n;
+        for (int i = i0; i < i1; i++) {
+            uint8_t k = coverage(cov, i);
+            if (k) line[px + i] = bt[line[px + i] & 0x03][k];
+        }
+    }
+}
+
+int SSD1322_AA_DrawString(int x, int y, const char *s, uint8_t gray)
+{
+    const ssd1322_aa_font_t *f = cur_font;
+    uint8_t bt[4][16];
+    int x0 = x;
+    uint32_t cp;
+
+    blend_table(bt, 4, gray & 0x03);
+    while ((cp = SSD1322_Utf8Next(&s, 0)) != 0) {
+        const ssd1322_aa_glyph_t *g = glyph_or_fallback(f, cp);
+        if (!g) continue;
+        draw_glyph(x, y, f, g, (const uint8_t (*)[16])bt);
+        x += g->advance;
+    }
+    return x - x0;
+}
+
+int SSD1322_AA_TextWidth(const char *s)
+{
+    const ssd1322_aa_font_t *f = cur_font;
+    int w = 0;
+    uint32_t cp;
+    while ((cp = SSD1322_Utf8Next(&s, 0)) != 0) {
+        const ssd1322_aa_glyph_t *g = glyph_or_fallback(f, cp);
+        if (g) w += g->advance;
+    }
+    return w;
+}
+
+void SSD1322_AA_DrawCenteredAtY(const char *s, int y, uint8_t gray)
+{
+    int x0 = (SSD1322_WIDTH - SSD1322_AA_TextWidth(s)) / 2;
+    if (x0 < 0) x0 = 0;   // sığmıyorsa sola yapıştır
+    SSD1322_AA_DrawString(x0, y, s, gray);
+}
+
+#ifndef SSD1322_NO_FRAMEBUFFER
+/* draw_glyph'in katman karşılığı: satır bir kez kırpılır, paketli piksel
+   yerinde okunup yazılır (MSB = sol), kirli alan glif başına bir kez */
+static void draw_glyph_layer(ssd1322_layer_t *l, int x, int y, const ssd1322_aa_font_t *f,
+                             const ssd1322_aa_glyph_t *g, const uint8_t (*bt)[16])
+{
+    const uint8_t *p = f->atlas + g->offset;
+    const int bpp = l->bpp;
+    const uint8_t vmask = (uint8_t)((1u << bpp) - 1);
+    int gx = x + g->dx, gy = y + g->dy;
+
+    for (int r = 0; r < g->h; r++) {
+        uint8_t hdr = *p++;
+        int n = hdr & 0x0F;
+        const uint8_t *cov = p;
+        p += (n + 1) / 2;
+        if (!n || gy + r < 0 || gy + r >= l->h) continue;
+
+        uint8_t *row = l->bits + (gy + r) * l->stride;
+        int px = gx + (hdr >> 4);
+        int i0 = px < 0 ? -px : 0;
+        int i1 = px + n > l->w ? l->w - px : n;
+        for (int i = i0; i < i1; i++) {
+            uint8_t k = coverage(cov, i);
+            if (!k) continue;
+            uint32_t bit = (uint32_t)(px + i) * bpp;
+            uint8_t shift = (uint8_t)(8 - bpp - (bit & 7));
+            uint8_t *q = &row[bit >> 3];
+            uint8_t v = bt[(*q >> shift) & vmask][k];
+            *q = (uint8_t)((*q & ~(vmask << shift)) | (v << shift));
+        }
+    }
+    SSD1322_Layer_MarkDirty(l, gx, gy, gx + g->w - 1, gy + g->h - 1);
+}
+
+int SSD1322_AA_DrawStringLayer(ssd1322_layer_t *l, int x, int y, const char *s, uint8_t level)
+{
+    const ssd1322_aa_font_t *f = cur_font;
+    int max = (1 << l->bpp) - 1;
+    uint8_t bt[16][16];
+    int x0 = x;
+    uint32_t cp;
+
+    blend_table(bt, max + 1, (uint8_t)(level > max ? max : level));
+    while ((cp = SSD1322_Utf8Next(&s, 0)) != 0) {
+        const ssd1322_aa_glyph_t *g = glyph_or_fallback(f, cp);
+        if (!g) continue;
+        draw_glyph_layer(l, x, y, f, g, (const uint8_t (*)[16])bt);
+        x += g->advance;
+    }
+    return x - x0;
+}
+#endif
@@ -0,0 +1,62 @@
+/* oled_aafont.h */
+
+#ifndef OLED_AAFONT_H
+#define OLED_AAFONT_H
+
+#include <stdint.h>
+#include "oled_ssd1322.h"
+
+/*
+ * Kenar yumuşatmalı (anti-aliased) metin.
+ * Glifler PC'de yüksek çözünürlükte taranır ve 4-bit kapsama olarak
+ * saklanır (tools/ssd1322_aafont.c). Atlas satır satırdır: her satır için
+ * bir başlık byte'ı (üst nibble boş piksel sayısı x0, alt nibble dolu
+ * aralık uzunluğu n), ardından n adet 4-bit kapsama (byte başına 2, üst
+ * nibble önce). Boş satır tek byte'tır, çizimde sadece aralık gezilir.
+ *
+ * Karışım tamsayı tablosuyla yapılır (kayan nokta yok):
+ *   sonuç = (hedef * (15 - k) + renk * k + 7) / 15
+ * Hedef 2-bit framebuf / yüzeyde renk 0..3; 4bpp katmanda
+ * (SSD1322_AA_DrawStringLayer) renk 0..15, panelin 16 seviyesi kullanılır.
+ *
+ * Glif kutusu en fazla 15 piksel genişliktedir.
+ */
+typedef struct {
+    uint16_t offset;      // atlas'ta ilk satır başlığı
+    uint8_t  w, h;        // kapsama kutusu
+    int8_t   dx;          // kalem konumuna göre kutunun solu
+    int8_t   dy;          // satır üstüne göre kutunun üstü
+    uint8_t  advance;
+} ssd1322_aa_glyph_t;
+
+typedef struct {
+    const uint16_t *codes;            // artan sırada kod noktaları
+    const ssd1322_aa_glyph_t *glyphs;
+    const uint8_t  *atlas;
+    uint16_t count;
+    uint8_t  height;                  // satır yüksekliği
+    uint8_t  baseline;                // satır üstünden taban çizgisine
+    uint16_t fallback;                // olmayan kod noktası yerine
+} ssd1322_aa_font_t;
+
+/* DejaVu Sans, 8 piksel, ASCII + Türkçe */
+extern const ssd1322_aa_font_t FontAA_Sans8;
+
+void SSD1322_AA_SetFont(const ssd1322_aa_font_t *f);   // NULL = FontAA_Sans8
+const ssd1322_aa_font_t *SSD1322_AA_GetFont(void);
+
+/* Glif ya da NULL, ikili arama */
+const ssd1322_aa_glyph_t *SSD1322_AA_Glyph(const ssd1322_aa_font_t *f, uint32_t cp);
+
+/* y = satır üstü. Kalemin ilerlediği genişliği döner */
+int  SSD1322_AA_DrawString(int x, int y, const char *s, uint8_t gray);
+int  SSD1322_AA_TextWidth(const char *s);
+void SSD1322_AA_DrawCenteredAtY(const char *s, int y, uint8_t gray);
+
+#ifndef SSD1322_NO_FRAMEBUFFER
+#include "oled_layer.h"
+/* 4bpp katmana (diğer derinliklerde seviye ölçeklenir), katman koordinatı */
+int  SSD1322_AA_DrawStringLayer(ssd1322_layer_t *l, int x, int y, const char *s, uint8_t level);
+#endif
+
+#endif /* OLED_AAFONT_H */
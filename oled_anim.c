@@ -0,0 +1,186 @@
+/* oled_anim.c */
+
+#include <stddef.h>
+#include "oled_anim.h"
+#include "oled_wire.h"
+
+static const uint8_t *an;            // akış, NULL = durdu
+static const uint8_t *an_next;       // sıradaki delta
+static uint16_t an_frames, an_ms, an_keys;
+static uint16_t an_cur, an_target;   // gönderilen kare, atlamada hedef
+static uint8_t  an_flags;
+static uint32_t an_due;
+static bool     an_timed;
+static uint32_t an_recoveries;       // kurtarma sayacı, değişince kare yeniden kurulur
+static int      an_shift;            // kare kurulurken yatay kayma
+static volatile bool an_resync;      // SSD1322_Anim_Resync istedi
+
+static uint16_t rd16(const uint8_t *p) { return (uint16_t)(p[0] | p[1] << 8); }
+static uint32_t rd32(const uint8_t *p) { return (uint32_t)rd16(p) | (uint32_t)rd16(p + 2) << 16; }
+
+static const uint8_t *key_entry(int i)
+{
+    return an + SSD1322_ANIM_HEADER + i * SSD1322_ANIM_KEY_SIZE;
+}
+
+/* Wire akışının sonrası (0x00'ın ardı), sadece başlıklar okunur */
+static const uint8_t *wire_skip(const uint8_t *p)
+{
+    for (;;) {
+        switch (p[0]) {
+            case SSD1322_WIRE_CMD:  p += 2 + p[1];       break;
+            case SSD1322_WIRE_DATA: p += 3 + rd16(p + 1); break;
+            default:                return p + 1;
+        }
+    }
+}
+
+/* Kare hemen başlar (DMA'da ilk kayıt, yoksa tamamı) */
+static void start_wire(const uint8_t *p)
+{
+    SSD1322_Wire_Start(p);
+    SSD1322_Wire_Poll();
+}
+
+static void send_next(void)
+{
+    const uint8_t *p = an_next;
+    an_next = wire_skip(p);
+    an_cur++;
+    start_wire(p);
+}
+
+/* En yakın önceki anahtar kareyi gönderir, hedefe kadar deltalar Poll'da */
+static void seek_to(uint16_t frame)
+{
+    int k = 0;
+    while (k + 1 < an_keys && rd16(key_entry(k + 1)) <= frame) k++;
+
+    const uint8_t *e = key_entry(k);
+    an_cur = rd16(e);
+    an_next = an + rd32(e + 6);
+    an_target = frame;
+    an_shift = SSD1322_GetShiftX();
+    start_wire(an + rd32(e + 2));
+}
+
+static uint32_t recoveries(void)
+{
+    ssd1322_link_stats_t st;
+    SSD1322_GetLinkStats(&st);
+    return st.recoveries;
+}
+
+uint16_t SSD1322_Anim_FrameCount(const uint8_t *stream)
+{
+    if (stream[0] != 'A' || stream[1] != 'N' || stream[2] != 'M' || stream[3] != '1') return 0;
+    return rd16(stream + 4);
+}
+
+bool SSD1322_Anim_Start(const uint8_t *stream, uint8_t flags)
+{
+    uint16_t n = SSD1322_Anim_FrameCount(stream);
+    if (!n || !rd16(stream + 8)) return false;
+    if (an) SSD1322_Anim_Stop();
+
+    an = stream;
+    an_frames = n;
+    an_ms = rd16(stream + 6);
+    an_keys = rd16(stream + 8);
+    an_flags = flags;
+    an_timed = false;
+    an_recoveries = recoveries();
+    an_resync = false;
+    seek_to(0);
+    return true;
+}
+
+void SSD1322_Anim_Stop(void)
+{
+    if (!an) return;
+    while (SSD1322_Wire_Poll()) { }
+    an = NULL;
+}
+
+void SSD1322_Anim_Seek(uint16_t frame)
+{
+    if (!an) return;
+    while (SSD1322_Wire_Poll()) { }
+    seek_to(frame < an_frames ? frame : (uint16_t)(an_frames - 1));
+    an_timed = false;
+}
+
+bool SSD1322_Anim_Poll(uint32_t now_ms)
+{
+    if (!an) return false;
+    if (SSD1322_Wire_Poll()) return true;                  // kare gidiyor
+
+    /* arıza: kare yarım kalmış ya da kurtarma framebuf'ı göndermiş olabilir;
+       kayma değişti: pencereler eski konumda */
+    if (!SSD1322_LinkOk()) return true;
+    uint32_t rec = recoveries();
+    if (rec != an_recoveries || an_resync || SSD1322_GetShiftX() != an_shift) {
+        an_recoveries = rec;
+        an_resync = false;
+        seek_to(an_cur);
+        return true;
+    }
+    if (an_cur < an_target) { send_next(); return true; }  // atlama: beklemeden
+
+    if (!an_timed) {
+        an_timed = true;
+        an_due = now_ms + an_ms;
+        return true;
+    }
+    if ((int32_t)(now_ms - an_due) < 0) return true;
+
+    if (an_cur + 1u >= an_frames) {
+        if (!(an_flags & SSD1322_ANIM_LOOP)) { an = NULL; return false; }
+        an_cur = 0;
+        an_target = 0;
+        an_next = an + rd32(key_entry(0) + 6);
+        start_wire(an + rd32(an + 10));                    // döngü deltası
+    } else {
+        send_next();
+    }
+
+    /* geride kaldıysa kare atlanmaz, zamanlama sıfırlanır */
+    an_due += an_ms;
+    if ((int32_t)(now_ms - an_due) > (int32_t)an_ms) an_due = now_ms;
+    return true;
+}
+
+void SSD1322_Anim_Resync(void *ctx)
+{
+    (void)ctx;
+    an_resync = true;
+}
+
+bool SSD1322_Anim_Active(void)
+{
+    return an != NULL;
+}
+
+uint16_t SSD1322_Anim_Frame(void)
+{
+    return an_cur;
+}
+
+void SSD1322_Anim_Run(const uint8_t *stream)
+{
+    if (!SSD1322_Anim_Start(stream, 0)) return;
+    uint32_t ok_t = HAL_GetTick();
+    for (;;) {
+        uint32_t now = HAL_GetTick();
+        if (SSD1322_Recover_Poll(now)) {                   // arızada Poll hep true döner
+            if ((uint32_t)(now - ok_t) >= SSD1322_ANIM_RUN_FAULT_MS) {
+                an = NULL;                                 // panel dönmedi: vazgeç
+                return;
+            }
+        } else {
+            ok_t = now;
+        }
+        if (!SSD1322_Anim_Poll(now)) return;
+        HAL_Delay(1);
+    }
+}
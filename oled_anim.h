@@ -0,0 +1,58 @@
+/* oled_anim.h */
+
+#ifndef OLED_ANIM_H
+#define OLED_ANIM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oled_ssd1322.h"
+
+/*
+ * Delta kodlu animasyon (tools/ssd1322_anim ile pişirilir, flash'ta durur).
+ * Her kare bir oled_wire akışıdır (0x00 ile biter) ve sadece önceki kareden
+ * değişen pencereleri taşır; gönderim SSD1322_Wire_Poll ile, DMA açıksa
+ * flash'tan doğrudan gider. CPU sadece kare sınırında kayıt başlıklarını
+ * atlar.
+ *
+ * Akış (little-endian):
+ *   'A' 'N' 'M' '1'
+ *   u16 kare sayısı, u16 kare süresi (ms), u16 anahtar sayısı,
+ *   u32 döngü deltası (son kare -> kare 0, akış başına göre)
+ *   anahtar tablosu: { u16 kare, u32 tam kare, u32 sonraki deltanın yeri }
+ *   kare 0 (tam), delta 1..n-1, döngü deltası, anahtar kareler
+ *
+ * Anahtar kareler delta zincirinin dışındadır, sadece atlamada (seek)
+ * gönderilir: en yakın önceki anahtar kare, ardından hedefe kadar deltalar
+ * beklemeden gider. Bağlantı kurtarmasından, yatay kayma değişiminden
+ * (oled_orbit) ya da SSD1322_Anim_Resync'ten sonra o anki kare aynı yolla
+ * yeniden kurulur. Anim_Resync resync callback'i olarak kaydedilebilir;
+ * böylece SSD1322_Resync framebuf'ı anim'in üzerine yazmaz.
+ *
+ * Oynatıcı framebuf'a dokunmaz; oled_wire motorunu kullanır, oynarken
+ * başka wire akışı başlatılmamalı.
+ */
+#define SSD1322_ANIM_HEADER   14
+#define SSD1322_ANIM_KEY_SIZE 10
+
+#define SSD1322_ANIM_LOOP     0x01
+
+/* Akış geçersizse false */
+bool SSD1322_Anim_Start(const uint8_t *stream, uint8_t flags);
+void SSD1322_Anim_Stop(void);                 // gönderilen kareyi bitirir
+
+/* SSD1322_Anim_Poll(HAL_GetTick()) ana döngüden; oynuyorsa true */
+bool SSD1322_Anim_Poll(uint32_t now_ms);
+void SSD1322_Anim_Seek(uint16_t frame);
+void SSD1322_Anim_Resync(void *ctx);          // sonraki Poll kareyi yeniden kurar
+bool SSD1322_Anim_Active(void);
+uint16_t SSD1322_Anim_Frame(void);           // ekrandaki (gönderilen) kare
+uint16_t SSD1322_Anim_FrameCount(const uint8_t *stream);
+
+/* Bloklayan oynatma (döngüsüz). Bağlantı kurtarmayı kendisi sürer; bağlantı
+   SSD1322_ANIM_RUN_FAULT_MS boyunca arızalı kalırsa oynatmayı bırakır */
+#ifndef SSD1322_ANIM_RUN_FAULT_MS
+#define SSD1322_ANIM_RUN_FAULT_MS 2000u
+#endif
+void SSD1322_Anim_Run(const uint8_t *stream);
+
+#endif /* OLED_ANIM_H */
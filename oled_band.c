@@ -0,0 +1,173 @@
+/* oled_band.c */
+
+#include <string.h>
+#include "oled_band.h"
+
+#ifdef SSD1322_USE_DMA
+#define BAND_BUFS 2
+#else
+#define BAND_BUFS 1
+#endif
+
+static uint8_t band_buf[BAND_BUFS][SSD1322_BAND_ROWS][SSD1322_WIDTH];
+
+static ssd1322_band_draw_fn band_draw;
+static void *band_ctx;
+static int8_t band_dx;                  // Render başında alınan yatay kayma
+
+void SSD1322_Band_SetDrawCallback(ssd1322_band_draw_fn draw, void *ctx)
+{
+    band_draw = draw;
+    band_ctx = ctx;
+}
+
+/* k. tampona y0'dan başlayan bandı çizer */
+static void band_draw_into(int k, int y0, int rows)
+{
+    ssd1322_surface_t surf;
+    ssd1322_surface_t *prev = ssd1322_target;
+
+    memset(band_buf[k], 0, sizeof(band_buf[k]));
+    SSD1322_SurfaceInit(&surf, &band_buf[k][0][0], SSD1322_WIDTH, rows, y0);
+    SSD1322_SetTarget(&surf);
+    if (band_draw) band_draw(band_ctx);
+    SSD1322_SetTarget(prev);
+}
+
+/* Bant satırını kaymayla paketler; açılan kolonlar (sıfırlanmış) siyah kalır */
+static void band_pack(uint8_t *out, const uint8_t *pix)
+{
+    int src = band_dx < 0 ? -band_dx : 0, dst = band_dx > 0 ? band_dx : 0;
+    SSD1322_PackLine(out + dst * 2, pix + src, SSD1322_WIDTH - src - dst);
+}
+
+#ifdef SSD1322_USE_DMA
+
+/* Satır satır ping-pong: bir satır DMA'dayken sıradaki paketlenir */
+static SSD1322_DMA_BUFFER uint8_t band_line[2][SSD1322_WIDTH * 2];
+
+static volatile int8_t  tx_band = -1;   // DMA'daki bant (-1 = boşta)
+static volatile int8_t  tx_next = -1;   // sırada bekleyen bant
+static volatile uint8_t tx_row;         // tx_band içindeki satır
+static volatile uint8_t tx_line;        // DMA'daki line buffer
+static uint8_t tx_rows[BAND_BUFS];      // bant başına satır sayısı
+
+/* DMA başlamadı / hata verdi: bant düşer, bağlantı arızalı; resync yeniden çizer */
+static void band_tx_fail(HAL_StatusTypeDef ret)
+{
+    tx_band = -1;   // bekleyen döngü kilitlenmesin
+    tx_next = -1;
+    SSD1322_LinkFault(ret, true);
+}
+
+static void band_tx_start(int k)
+{
+    if (!SSD1322_LinkOk()) {   // önceki bant arızalandı
+        tx_band = -1;
+        tx_next = -1;
+        return;
+    }
+    tx_band = (int8_t)k;
+    tx_row = 0;
+    tx_line = 0;
+    band_pack(band_line[0], band_buf[k][0]);
+    HAL_StatusTypeDef ret = HAL_SPI_Transmit_DMA(&hspi2, band_line[0], sizeof(band_line[0]));
+    if (ret != HAL_OK) {
+        band_tx_fail(ret);
+        return;
+    }
+    if (tx_rows[k] > 1)
+        band_pack(band_line[1], band_buf[k][1]);
+}
+
+void SSD1322_Band_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi)
+{
+    if (hspi != &hspi2 || tx_band < 0) return;
+
+    int k = tx_band;
+    tx_row++;
+    if (tx_row < tx_rows[k]) {
+        tx_line ^= 1;
+        HAL_StatusTypeDef ret = HAL_SPI_Transmit_DMA(&hspi2, band_line[tx_line], sizeof(band_line[0]));
+        if (ret != HAL_OK) {
+            band_tx_fail(ret);
+            return;
+        }
+        if (tx_row + 1 < tx_rows[k])
+            band_pack(band_line[tx_line ^ 1], band_buf[k][tx_row + 1]);
+        return;
+    }
+
+    /* bant bitti, sıradakini başlat */
+    tx_band = -1;
+    if (tx_next >= 0) {
+        int n = tx_next;
+        tx_next = -1;
+        band_tx_start(n);
+    }
+}
+
+void SSD1322_Band_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
+{
+    if (hspi != &hspi2 || tx_band < 0) return;
+    band_tx_fail(HAL_ERROR);
+}
+
+static void band_queue(int k, int rows)
+{
+    tx_rows[k] = (uint8_t)rows;
+    __disable_irq();
+    if (tx_band < 0) band_tx_start(k);
+    else             tx_next = (int8_t)k;
+    __enable_irq();
+}
+
+void SSD1322_Band_Render(void)
+{
+    SSD1322_SetColumn(COLUMN_START, COLUMN_END);
+    SSD1322_SetRow(ROW_START, ROW_END);
+    SSD1322_SendCommand(0x5C); // Write RAM
+    if (!SSD1322_LinkOk()) return;   // bağlantı arızalı: resync callback'i yeniden çizer
+    band_dx = (int8_t)SSD1322_GetShiftX();
+    memset(band_line, 0, sizeof(band_line));
+    SSD1322_DataBegin();
+
+    int k = 0;
+    for (int y = 0; y < SSD1322_HEIGHT; y += SSD1322_BAND_ROWS, k ^= 1) {
+        int rows = SSD1322_HEIGHT - y;
+        if (rows > SSD1322_BAND_ROWS) rows = SSD1322_BAND_ROWS;
+
+        while (tx_band == k || tx_next == k) { }   // tampon hâlâ gönderiliyor
+        if (!SSD1322_LinkOk()) break;              // DMA hatası: kalan bantlar çizilmez
+        band_draw_into(k, y, rows);
+        band_queue(k, rows);
+    }
+
+    while (tx_band >= 0 || tx_next >= 0) { }
+    SSD1322_DataEnd();
+}
+
+#else
+
+void SSD1322_Band_Render(void)
+{
+    SSD1322_SetColumn(COLUMN_START, COLUMN_END);
+    SSD1322_SetRow(ROW_START, ROW_END);
+    SSD1322_SendCommand(0x5C); // Write RAM
+    if (!SSD1322_LinkOk()) return;   // bağlantı arızalı: resync callback'i yeniden çizer
+    band_dx = (int8_t)SSD1322_GetShiftX();
+
+    uint8_t linebuf[SSD1322_WIDTH * 2] = { 0 };
+    for (int y = 0; y < SSD1322_HEIGHT; y += SSD1322_BAND_ROWS) {
+        int rows = SSD1322_HEIGHT - y;
+        if (rows > SSD1322_BAND_ROWS) rows = SSD1322_BAND_ROWS;
+
+        band_draw_into(0, y, rows);
+        for (int r = 0; r < rows; r++) {
+            band_pack(linebuf, band_buf[0][r]);
+            SSD1322_WriteData(linebuf, sizeof(linebuf));
+        }
+    }
+}
+
+#endif
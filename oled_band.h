@@ -0,0 +1,51 @@
+/* oled_band.h */
+
+#ifndef OLED_BAND_H
+#define OLED_BAND_H
+
+#include <stdint.h>
+#include "oled_ssd1322.h"
+
+/*
+ * Framebuffer'sız band renderer.
+ * Ekran SSD1322_BAND_ROWS satırlık bantlar halinde çizilir: her bant için
+ * çizim callback'i bant tamponu hedef seçilmiş olarak çağrılır, bant GDDRAM'a
+ * gönderilir ve sıradakine geçilir. Callback tüm sahneyi çizer; bant dışına
+ * düşen pikseller clip ile atılır.
+ *
+ * SSD1322_USE_DMA tanımlıysa iki bant tamponu kullanılır: bir bant DMA ile
+ * giderken diğeri çizilir. Bu modda uygulamanın HAL_SPI_TxCpltCallback'i
+ * SSD1322_Band_SPI_TxCpltCallback'i, HAL_SPI_ErrorCallback'i de
+ * SSD1322_Band_SPI_ErrorCallback'i çağırmalıdır. DMA başlatma ya da
+ * transfer hatası bağlantıyı arızalı işaretler (SSD1322_LinkFault): Render
+ * kalan bantları bırakır, kurtarmadan sonra resync callback'i yeniden çizer.
+ *
+ * Yatay kayma (SSD1322_SetShiftX) Render başında alınır, taşan kolonlar
+ * atılır, açılan kolonlar siyah gider. Kayma değişince (oled_orbit)
+ * SSD1322_Resync resync callback'ini çağırır; Render oradan yapılmalı.
+ *
+ * RAM: DMA'sız BAND_ROWS*128 + 256 (stack), DMA ile 2*BAND_ROWS*128 + 512 byte.
+ * SSD1322_NO_FRAMEBUFFER ile 8 KB framebuf hiç ayrılmaz.
+ */
+#ifndef SSD1322_BAND_ROWS
+#define SSD1322_BAND_ROWS 4
+#endif
+
+/* DMA tamponlarının yerleşimi (H7'de D-cache dışı bir bölge önerilir) */
+#ifndef SSD1322_DMA_BUFFER
+#define SSD1322_DMA_BUFFER
+#endif
+
+typedef void (*ssd1322_band_draw_fn)(void *ctx);
+
+void SSD1322_Band_SetDrawCallback(ssd1322_band_draw_fn draw, void *ctx);
+
+/* Tüm ekranı bant bant çizip gönderir (DMA modunda son bant bitene kadar bekler) */
+void SSD1322_Band_Render(void);
+
+#ifdef SSD1322_USE_DMA
+void SSD1322_Band_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi);
+void SSD1322_Band_SPI_ErrorCallback(SPI_HandleTypeDef *hspi);
+#endif
+
+#endif /* OLED_BAND_H */
@@ -0,0 +1,170 @@
+/* oled_bigfont.c */
+
+#include <string.h>
+#include "oled_bigfont.h"
+#include "oled_font.h"
+
+/* 4 bitin s katına genişletilmesi, MSB = sol [s - 2][nibble] */
+static const uint16_t expand_nibble[SSD1322_BIG_SCALE_MAX - 1][16] = {
+    { 0x0000, 0x0003, 0x000C, 0x000F, 0x0030, 0x0033, 0x003C, 0x003F,
+      0x00C0, 0x00C3, 0x00CC, 0x00CF, 0x00F0, 0x00F3, 0x00FC, 0x00FF },
+    { 0x0000, 0x0007, 0x0038, 0x003F, 0x01C0, 0x01C7, 0x01F8, 0x01FF,
+      0x0E00, 0x0E07, 0x0E38, 0x0E3F, 0x0FC0, 0x0FC7, 0x0FF8, 0x0FFF },
+    { 0x0000, 0x000F, 0x00F0, 0x00FF, 0x0F00, 0x0F0F, 0x0FF0, 0x0FFF,
+      0xF000, 0xF00F, 0xF0F0, 0xF0FF, 0xFF00, 0xFF0F, 0xFFF0, 0xFFFF },
+};
+
+static int clamp_scale(int scale)
+{
+    return scale < 1 ? 1 : scale > SSD1322_BIG_SCALE_MAX ? SSD1322_BIG_SCALE_MAX : scale;
+}
+
+/* w bitlik satırı (MSB = sol, w <= 16) s katına genişletir: w * s bit */
+static uint64_t expand_row(uint32_t bits, int w, int s)
+{
+    if (s == 1) return bits;
+    const uint16_t *t = expand_nibble[s - 2];
+    uint32_t v = bits << (16 - w);   // 16 bite sola hizalı
+    uint64_t m = 0;
+    for (int k = 12; k >= 0; k -= 4)
+        m = (m << (4 * s)) | t[(v >> k) & 0x0F];
+    return m >> ((16 - w) * s);
+}
+
+/* Maskeyi satıra koşular halinde yazar: 1 = 3, 0 = 0 (kırpılır) */
+static void put_span_bits(uint8_t *line, int x, uint64_t m, int n)
+{
+    const ssd1322_surface_t *t = ssd1322_target;
+    int i = 0;
+    while (i < n) {
+        bool on = (m >> (n - 1 - i)) & 1u;
+        int j = i + 1;
+        while (j < n && (((m >> (n - 1 - j)) & 1u) == on)) j++;
+
+        int a = x + i, b = x + j - 1;
+        if (a < t->clip_x0) a = t->clip_x0;
+        if (b > t->clip_x1) b = t->clip_x1;
+        if (a <= b) memset(line + a, on ? 3 : 0, (size_t)(b - a + 1));
+        i = j;
+    }
+}
+
+static void put_pixel(int x, int y, uint8_t g)
+{
+    const ssd1322_surface_t *t = ssd1322_target;
+    uint8_t *line = SSD1322_TargetRow(y);
+    if (line && x >= t->clip_x0 && x <= t->clip_x1 && line[x] < g) line[x] = g;
+}
+
+/*
+ * Çapraz basamak yumuşatma: boş kaynak pikselin iki komşu kenarı dolu,
+ * karşı kenarları boşsa o köşeye üçgen çizilir. dx/dy köşe yönü (0 / 1).
+ */
+static void smooth_corner(int bx, int by, int s, int dx, int dy)
+{
+    for (int i = 0; i < s; i++) {
+        for (int j = 0; j + i < s; j++) {
+            int px = dx ? bx + s - 1 - j : bx + j;
+            int py = dy ? by + s - 1 - i : by + i;
+            put_pixel(px, py, i + j < s - 1 ? 2 : 1);
+        }
+    }
+}
+
+static void smooth_glyph(int x, int y, const uint16_t *rows, int w, int h, int s)
+{
+#define ON(r, c) ((r) >= 0 && (r) < h && (c) >= 0 && (c) < w && ((rows[r] >> (w - 1 - (c))) & 1u))
+    for (int r = 0; r < h; r++) {
+        for (int c = 0; c < w; c++) {
+            if (ON(r, c)) continue;
+            bool u = ON(r - 1, c), d = ON(r + 1, c), l = ON(r, c - 1), rt = ON(r, c + 1);
+            int bx = x + c * s, by = y + r * s;
+            if (u && l && !d && !rt) smooth_corner(bx, by, s, 0, 0);
+            if (u && rt && !d && !l) smooth_corner(bx, by, s, 1, 0);
+            if (d && l && !u && !rt) smooth_corner(bx, by, s, 0, 1);
+            if (d && rt && !u && !l) smooth_corner(bx, by, s, 1, 1);
+        }
+    }
+#undef ON
+}
+
+static void draw_glyph_data_scaled(int x, int y, const ssd1322_font_t *f,
+                                   const uint8_t *glyph, int s, uint8_t flags)
+{
+    uint16_t rows[16];
+    int w = f->w > 16 ? 16 : f->w, h = f->h, n = w * s;
+
+    /* kolon düzeninden satır maskelerine */
+    for (int r = 0; r < h; r++) {
+        const uint8_t *col_bits = glyph + (r >> 3);
+        uint16_t bits = 0;
+        for (int c = 0; c < w; c++, col_bits += f->col_bytes)
+            bits = (uint16_t)((bits << 1) | ((*col_bits >> (r & 7)) & 1u));
+        rows[r] = bits;
+    }
+
+    const ssd1322_surface_t *t = ssd1322_target;
+    for (int r = 0; r < h; r++) {
+        uint64_t m = expand_row(rows[r], w, s);
+        uint8_t *first = NULL;
+        for (int k = 0; k < s; k++) {
+            int yy = y + r * s + k;
+            uint8_t *line = SSD1322_TargetRow(yy);
+            if (!line) continue;
+            if (!first) {
+                put_span_bits(line, x, m, n);
+                first = line;
+                continue;
+            }
+            /* aynı satır: kırpılmış aralığı kopyala */
+            int a = x < t->clip_x0 ? t->clip_x0 : x;
+            int b = x + n - 1 > t->clip_x1 ? t->clip_x1 : x + n - 1;
+            if (a <= b) memcpy(line + a, first + a, (size_t)(b - a + 1));
+        }
+    }
+
+    if ((flags & SSD1322_BIG_SMOOTH) && s >= 2)
+        smooth_glyph(x, y, rows, w, h, s);
+}
+
+void SSD1322_DrawGlyphScaled(int x, int y, uint32_t cp, int scale, uint8_t flags)
+{
+    const ssd1322_font_t *f = SSD1322_GetFont();
+    const uint8_t *glyph = SSD1322_FontGlyph(f, cp);
+    if (!glyph) glyph = SSD1322_FontGlyph(f, f->fallback);
+    if (glyph) draw_glyph_data_scaled(x, y, f, glyph, clamp_scale(scale), flags);
+}
+
+int SSD1322_TextWidthScaled(const char *s, int scale)
+{
+    return SSD1322_TextWidth(s) * clamp_scale(scale);
+}
+
+int SSD1322_DrawStringScaled(int x, int y, const char *s, int scale, uint8_t flags)
+{
+    const ssd1322_font_t *f = SSD1322_GetFont();
+    int sc = clamp_scale(scale), n = 0;
+    uint32_t cp;
+
+    for (; (cp = SSD1322_Utf8Next(&s, NULL)) != 0; x += f->advance * sc, n++)
+        SSD1322_DrawGlyphScaled(x, y, cp, sc, flags);
+    return SSD1322_FontTextWidth(f, n) * sc;
+}
+
+void SSD1322_DrawCenteredScaledAtY(const char *s, int y, int scale, uint8_t flags)
+{
+    int x0 = (SSD1322_WIDTH - SSD1322_TextWidthScaled(s, scale)) / 2;
+    if (x0 < 0) x0 = 0;   // sığmıyorsa sola yapıştır
+    SSD1322_DrawStringScaled(x0, y, s, scale, flags);
+}
+
+#ifndef SSD1322_NO_FRAMEBUFFER
+void SSD1322_DrawStringCenteredScaled(const char *s, int scale, uint8_t flags)
+{
+    int h = SSD1322_GetFont()->h * clamp_scale(scale);
+
+    SSD1322_ClearFramebuffer();
+    SSD1322_DrawCenteredScaledAtY(s, (SSD1322_HEIGHT - h) / 2, scale, flags);
+    SSD1322_RefreshFromFramebuffer();
+}
+#endif
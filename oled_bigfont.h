@@ -0,0 +1,42 @@
+/* oled_bigfont.h */
+
+#ifndef OLED_BIGFONT_H
+#define OLED_BIGFONT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oled_ssd1322.h"
+
+/*
+ * Tamsayı ölçekli metin (2x, 3x, 4x), aktif font ile.
+ * Glif satırı bir bit maskesine toplanır, nibble başına hazır genişletme
+ * tablosuyla ölçeklenir ve hedef satıra koşu koşu (memset) yazılır;
+ * ölçeklenmiş satır kalan s-1 satıra kopyalanır. SetPixel döngüsü yok.
+ *
+ * SSD1322_BIG_SMOOTH: ölçek >= 2'de çapraz basamakların iç köşeleri ara
+ * gri (2 / 1) üçgenlerle doldurulur. Framebuf 2-bit olduğu için kenar
+ * yumuşatma iki ara seviye kullanır.
+ *
+ * Glif hücresi opaktır (boş pikseller 0), glif genişliği en fazla 16.
+ */
+#define SSD1322_BIG_SCALE_MAX 4
+
+#define SSD1322_BIG_SMOOTH    0x01
+
+/* Tek satır genişliği (piksel) */
+int  SSD1322_TextWidthScaled(const char *s, int scale);
+
+void SSD1322_DrawGlyphScaled(int x, int y, uint32_t cp, int scale, uint8_t flags);
+
+/* Çizilen genişliği döner */
+int  SSD1322_DrawStringScaled(int x, int y, const char *s, int scale, uint8_t flags);
+
+/* Yatayda ortalı (draw_centered_at_y karşılığı) */
+void SSD1322_DrawCenteredScaledAtY(const char *s, int y, int scale, uint8_t flags);
+
+#ifndef SSD1322_NO_FRAMEBUFFER
+/* Framebuf'ı temizler, ekranın ortasına çizer ve gönderir (SSD1322_DrawStringCentered karşılığı) */
+void SSD1322_DrawStringCenteredScaled(const char *s, int scale, uint8_t flags);
+#endif
+
+#endif /* OLED_BIGFONT_H */
@@ -0,0 +1,160 @@
+/* oled_chart.c */
+
+#include <string.h>
+#include "oled_chart.h"
+
+/* Değer -> ekran satırı (lo alt kenar, hi üst kenar) */
+static int value_row(const ssd1322_chart_t *c, int32_t v)
+{
+    if (v <= c->lo) return c->y + c->h - 1;
+    if (v >= c->hi) return c->y;
+    int32_t off = (int32_t)(((int64_t)(v - c->lo) * (c->h - 1)) / (c->hi - c->lo));
+    return c->y + c->h - 1 - off;
+}
+
+/* Tek kolon: arka plan + her izin dikey aralığı */
+static void draw_column(const ssd1322_chart_t *c, int sx, int idx)
+{
+    const ssd1322_surface_t *t = ssd1322_target;
+    if (sx < t->clip_x0 || sx > t->clip_x1) return;
+
+    for (int r = c->y; r < c->y + c->h; r++) {
+        uint8_t *line = SSD1322_TargetRow(r);
+        if (line) line[sx] = c->bg;
+    }
+    for (int k = 0; k < c->n_traces; k++) {
+        int top = value_row(c, c->col_hi[k][idx]);
+        int bot = value_row(c, c->col_lo[k][idx]);
+        for (int r = top; r <= bot; r++) {
+            uint8_t *line = SSD1322_TargetRow(r);
+            if (line) line[sx] = c->gray[k];
+        }
+    }
+}
+
+/* Halkadaki aralığa göre ölçek; kenar payı 1/8 */
+static bool autoscale(ssd1322_chart_t *c, bool allow_shrink)
+{
+    int32_t mn = INT32_MAX, mx = INT32_MIN;
+    for (int k = 0; k < c->n_traces; k++) {
+        for (int i = 0; i < c->count; i++) {
+            int idx = (c->head - c->count + i + c->w) % c->w;
+            if (c->col_lo[k][idx] < mn) mn = c->col_lo[k][idx];
+            if (c->col_hi[k][idx] > mx) mx = c->col_hi[k][idx];
+        }
+    }
+    if (mn > mx) return false;
+
+    bool grow = mn < c->lo || mx > c->hi;
+    bool shrink = allow_shrink && (int64_t)(mx - mn) * 2 < (int64_t)(c->hi - c->lo);
+    if (!grow && !shrink) return false;
+
+    int32_t pad = (mx - mn) / 8 + 1;
+    c->lo = mn - pad;
+    c->hi = mx + pad;
+    return true;
+}
+
+void SSD1322_Chart_Init(ssd1322_chart_t *c, int x, int y, int w, int h,
+                        int n_traces, uint16_t samples_per_col, uint8_t flags)
+{
+    memset(c, 0, sizeof(*c));
+    if (w < 1) w = 1;            // % w ve (h - 1) ölçeği için
+    if (h < 1) h = 1;
+    if (w > SSD1322_CHART_MAX_W) w = SSD1322_CHART_MAX_W;
+    if (n_traces < 0) n_traces = 0;
+    if (n_traces > SSD1322_CHART_MAX_TRACES) n_traces = SSD1322_CHART_MAX_TRACES;
+    c->x = (int16_t)x;
+    c->y = (int16_t)y;
+    c->w = (int16_t)w;
+    c->h = (int16_t)h;
+    c->n_traces = (uint8_t)n_traces;
+    c->samples_per_col = samples_per_col ? samples_per_col : 1;
+    c->flags = flags;
+    c->lo = -1;
+    c->hi = 1;
+    for (int k = 0; k < SSD1322_CHART_MAX_TRACES; k++) c->gray[k] = SSD1322_GRAY_MAX;
+}
+
+void SSD1322_Chart_SetRange(ssd1322_chart_t *c, int32_t lo, int32_t hi)
+{
+    c->lo = lo;
+    c->hi = hi > lo ? hi : lo + 1;
+    c->flags &= (uint8_t)~SSD1322_CHART_AUTOSCALE;
+}
+
+void SSD1322_Chart_SetTraceGray(ssd1322_chart_t *c, int trace, uint8_t gray)
+{
+    if (trace >= 0 && trace < SSD1322_CHART_MAX_TRACES) c->gray[trace] = gray & 0x03;
+}
+
+void SSD1322_Chart_Draw(ssd1322_chart_t *c)
+{
+    SSD1322_FillRect(c->x, c->y, c->w - c->count, c->h, c->bg);
+    for (int i = 0; i < c->count; i++)
+        draw_column(c, c->x + c->w - c->count + i, (c->head - c->count + i + c->w) % c->w);
+}
+
+bool SSD1322_Chart_Push(ssd1322_chart_t *c, const int16_t *values)
+{
+    for (int k = 0; k < c->n_traces; k++) {
+        int16_t v = values[k];
+        if (!c->acc_n || v < c->acc_min[k]) c->acc_min[k] = v;
+        if (!c->acc_n || v > c->acc_max[k]) c->acc_max[k] = v;
+        c->acc_last[k] = v;
+    }
+    if (++c->acc_n < c->samples_per_col) return false;
+
+    /* kolon tamam: halkaya yaz */
+    int idx = c->head;
+    bool first = c->count == 0;
+    for (int k = 0; k < c->n_traces; k++) {
+        int16_t lo = c->acc_min[k], hi = c->acc_max[k];
+        if (!(c->flags & SSD1322_CHART_ENVELOPE)) {
+            /* önceki kolonun son örneğinden bu kolonun sonuna çizgi */
+            int16_t a = first ? c->acc_last[k] : c->prev_last[k], b = c->acc_last[k];
+            lo = a < b ? a : b;
+            hi = a < b ? b : a;
+        }
+        c->col_lo[k][idx] = lo;
+        c->col_hi[k][idx] = hi;
+        c->prev_last[k] = c->acc_last[k];
+    }
+    c->acc_n = 0;
+    c->head = (uint16_t)((c->head + 1) % c->w);
+    if (c->count < c->w) c->count++;
+
+    bool redraw = false;
+    if (c->flags & SSD1322_CHART_AUTOSCALE) {
+        /* büyüme her kolonda, daralma halka başına bir kez */
+        bool grow = false;
+        for (int k = 0; k < c->n_traces; k++)
+            if (c->col_lo[k][idx] < c->lo || c->col_hi[k][idx] > c->hi) grow = true;
+        if (grow || c->head == 0) redraw = autoscale(c, c->head == 0);
+    }
+
+    if (redraw) {
+        SSD1322_Chart_Draw(c);
+    } else {
+        /* bölgeyi bir kolon sola kaydır, yeni kolonu çiz */
+        const ssd1322_surface_t *t = ssd1322_target;
+        int x0 = c->x < t->clip_x0 ? t->clip_x0 : c->x;
+        int x1 = c->x + c->w - 1 > t->clip_x1 ? t->clip_x1 : c->x + c->w - 1;
+        if (x0 < x1) {
+            for (int r = c->y; r < c->y + c->h; r++) {
+                uint8_t *line = SSD1322_TargetRow(r);
+                if (line) memmove(line + x0, line + x0 + 1, (size_t)(x1 - x0));
+            }
+        }
+        draw_column(c, c->x + c->w - 1, idx);
+    }
+
+    if (c->flags & SSD1322_CHART_NO_REFRESH) {
+        SSD1322_MarkDirty(c->x, c->y, c->x + c->w - 1, c->y + c->h - 1);
+    } else {
+#ifndef SSD1322_NO_FRAMEBUFFER
+        SSD1322_RefreshRegion(c->x, c->y, c->x + c->w - 1, c->y + c->h - 1);
+#endif
+    }
+    return true;
+}
@@ -0,0 +1,71 @@
+/* oled_chart.h */
+
+#ifndef OLED_CHART_H
+#define OLED_CHART_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oled_ssd1322.h"
+
+/*
+ * Kayan zaman serisi grafiği (strip chart).
+ * Örnekler kolon kolon birikir: samples_per_col örnek bir kolon olur,
+ * örnek başına iş sabittir (iz başına min/max/son güncellemesi).
+ * Kolon tamamlanınca grafik bölgesi hedefte bir kolon sola kaydırılır
+ * (satır başına memmove), sadece yeni kolon çizilir ve sadece grafik
+ * penceresi gönderilir.
+ *
+ * Kolonların değer aralıkları bir halkada tutulur; ölçek değişince
+ * (autoscale) grafik halkadan yeniden çizilir. Daralma kontrolü halka
+ * her turladığında bir kez yapılır.
+ *
+ * Kaydırma hedefin içeriğine dayanır: hedef kalıcı olmalı (framebuf).
+ * Band renderer ile SSD1322_Chart_Draw kullanılır.
+ */
+#ifndef SSD1322_CHART_MAX_TRACES
+#define SSD1322_CHART_MAX_TRACES 4
+#endif
+
+#ifndef SSD1322_CHART_MAX_W
+#define SSD1322_CHART_MAX_W SSD1322_WIDTH
+#endif
+
+/* flags */
+#define SSD1322_CHART_AUTOSCALE   0x01
+#define SSD1322_CHART_ENVELOPE    0x02   // kolonda min..max çiz (yoksa son örnekleri birleştir)
+#define SSD1322_CHART_NO_REFRESH  0x04   // pencereyi gönderme, sadece kirli işaretle
+
+typedef struct {
+    int16_t x, y, w, h;
+    uint8_t flags;
+    uint8_t n_traces;
+    uint8_t bg;                                   // arka plan grisi
+    uint8_t gray[SSD1322_CHART_MAX_TRACES];       // iz renkleri
+    int32_t lo, hi;                               // dikey ölçek
+
+    /* birikmekte olan kolon */
+    uint16_t samples_per_col, acc_n;
+    int16_t acc_min[SSD1322_CHART_MAX_TRACES];
+    int16_t acc_max[SSD1322_CHART_MAX_TRACES];
+    int16_t acc_last[SSD1322_CHART_MAX_TRACES];
+    int16_t prev_last[SSD1322_CHART_MAX_TRACES];
+
+    /* kolon halkası: iz başına çizilen değer aralığı */
+    uint16_t head, count;
+    int16_t col_lo[SSD1322_CHART_MAX_TRACES][SSD1322_CHART_MAX_W];
+    int16_t col_hi[SSD1322_CHART_MAX_TRACES][SSD1322_CHART_MAX_W];
+} ssd1322_chart_t;
+
+/* İz renkleri varsayılan olarak SSD1322_GRAY_MAX; w 1..MAX_W, h >= 1, iz sayısı 0..MAX_TRACES'ye sınırlanır */
+void SSD1322_Chart_Init(ssd1322_chart_t *c, int x, int y, int w, int h,
+                        int n_traces, uint16_t samples_per_col, uint8_t flags);
+void SSD1322_Chart_SetRange(ssd1322_chart_t *c, int32_t lo, int32_t hi);   // sabit ölçek, autoscale kapanır
+void SSD1322_Chart_SetTraceGray(ssd1322_chart_t *c, int trace, uint8_t gray);
+
+/* n_traces değer; kolon tamamlanınca çizer (ve gönderir), true döner */
+bool SSD1322_Chart_Push(ssd1322_chart_t *c, const int16_t *values);
+
+/* Halkadan tam yeniden çizim (refresh yapmaz) */
+void SSD1322_Chart_Draw(ssd1322_chart_t *c);
+
+#endif /* OLED_CHART_H */
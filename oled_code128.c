@@ -0,0 +1,120 @@
+/* oled_code128.c */
+
+#include "oled_code128.h"
+
+#define SYM_CODE_C   99
+#define SYM_CODE_B   100
+#define SYM_START_B  104
+#define SYM_START_C  105
+
+/* Sembol desenleri: 11 modül, MSB = sol, 1 = çubuk */
+static const uint16_t patterns[106] = {
+    0x6CC, 0x66C, 0x666, 0x498, 0x48C, 0x44C, 0x4C8, 0x4C4,
+    0x464, 0x648, 0x644, 0x624, 0x59C, 0x4DC, 0x4CE, 0x5CC,
+    0x4EC, 0x4E6, 0x672, 0x65C, 0x64E, 0x6E4, 0x674, 0x76E,
+    0x74C, 0x72C, 0x726, 0x764, 0x734, 0x732, 0x6D8, 0x6C6,
+    0x636, 0x518, 0x458, 0x446, 0x588, 0x468, 0x462, 0x688,
+    0x628, 0x622, 0x5B8, 0x58E, 0x46E, 0x5D8, 0x5C6, 0x476,
+    0x776, 0x68E, 0x62E, 0x6E8, 0x6E2, 0x6EE, 0x758, 0x746,
+    0x716, 0x768, 0x762, 0x71A, 0x77A, 0x642, 0x78A, 0x530,
+    0x50C, 0x4B0, 0x486, 0x42C, 0x426, 0x590, 0x584, 0x4D0,
+    0x4C2, 0x434, 0x432, 0x612, 0x650, 0x7BA, 0x614, 0x47A,
+    0x53C, 0x4BC, 0x49E, 0x5E4, 0x4F4, 0x4F2, 0x7A4, 0x794,
+    0x792, 0x6DE, 0x6F6, 0x7B6, 0x578, 0x51E, 0x45E, 0x5E8,
+    0x5E2, 0x7A8, 0x7A2, 0x5DE, 0x5EE, 0x75E, 0x7AE, 0x684,
+    0x690, 0x69C,
+};
+#define STOP_PATTERN 0x18EBu   // 13 modül
+#define STOP_MODULES 13
+
+static uint8_t syms[SSD1322_CODE128_MAX];
+static int     n_syms;
+
+static int digits_at(const char *p)
+{
+    int n = 0;
+    while (p[n] >= '0' && p[n] <= '9') n++;
+    return n;
+}
+
+bool SSD1322_Code128_Encode(const char *s)
+{
+    const char *p = s;
+    int n = 0;
+    bool set_c;
+
+    n_syms = 0;
+    int d = digits_at(p);
+    set_c = d >= 4 || (d == 2 && !p[2]);
+    syms[n++] = set_c ? SYM_START_C : SYM_START_B;
+
+    while (*p) {
+        if (n + 3 > SSD1322_CODE128_MAX) return false;   // + geçiş + sağlama
+        if (set_c) {
+            if (digits_at(p) >= 2) {
+                syms[n++] = (uint8_t)((p[0] - '0') * 10 + (p[1] - '0'));
+                p += 2;
+            } else {
+                syms[n++] = SYM_CODE_B;
+                set_c = false;
+            }
+            continue;
+        }
+
+        /* B: ortada 6, sonda 4 rakamdan itibaren C'ye geç (tek rakam B'de kalır) */
+        d = digits_at(p);
+        if (d >= 6 || (d >= 4 && !p[d])) {
+            if (d & 1) syms[n++] = (uint8_t)(*p++ - 32);
+            syms[n++] = SYM_CODE_C;
+            set_c = true;
+            continue;
+        }
+        uint8_t c = (uint8_t)*p++;
+        if (c < 32 || c > 127) return false;
+        syms[n++] = (uint8_t)(c - 32);
+    }
+
+    uint32_t sum = syms[0];
+    for (int i = 1; i < n; i++) sum += (uint32_t)i * syms[i];
+    syms[n++] = (uint8_t)(sum % 103);
+    n_syms = n;
+    return true;
+}
+
+int SSD1322_Code128_Modules(void)
+{
+    return n_syms ? n_syms * 11 + STOP_MODULES : 0;
+}
+
+/* Desenin çubuklarını (1 koşuları) doldurur, x'i ilerletir */
+static int draw_pattern(int x, int y, int h, int scale, uint16_t pat, int bits)
+{
+    for (int i = bits - 1; i >= 0;) {
+        int run = 0;
+        bool bar = (pat >> i) & 1u;
+        while (i >= 0 && ((pat >> i) & 1u) == bar) { run++; i--; }
+        if (bar) SSD1322_FillRect(x, y, run * scale, h, 0);
+        x += run * scale;
+    }
+    return x;
+}
+
+int SSD1322_Code128_Draw(int x, int y, int w, int h, int quiet)
+{
+    int mods = SSD1322_Code128_Modules(), scale = 0;
+    if (!mods) return 0;
+
+    for (; quiet >= 0; quiet--)
+        if ((scale = w / (mods + 2 * quiet)) >= 1) break;
+    if (scale < 1) return 0;
+
+    int px = scale * (mods + 2 * quiet);
+    int ox = x + (w - px) / 2;
+    SSD1322_FillRect(ox, y, px, h, SSD1322_CODE128_LIGHT);
+
+    ox += quiet * scale;
+    for (int i = 0; i < n_syms; i++)
+        ox = draw_pattern(ox, y, h, scale, patterns[syms[i]], 11);
+    draw_pattern(ox, y, h, scale, STOP_PATTERN, STOP_MODULES);
+    return scale;
+}
@@ -0,0 +1,40 @@
+/* oled_code128.h */
+
+#ifndef OLED_CODE128_H
+#define OLED_CODE128_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oled_ssd1322.h"
+
+/*
+ * Code128 barkod (kod seti B + rakam koşuları için C).
+ * Dört ve daha uzun rakam dizileri ikişer ikişer C setinde kodlanır:
+ * seri numaraları yarı genişlikte çıkar.
+ *
+ * Sembol değerleri sabit bir statik diziye yazılır, heap yok. Çizim her
+ * çubuğu ölçekli tek bir FillRect olarak açık zemine (SSD1322_CODE128_LIGHT)
+ * doldurur; refresh çağıran tarafındadır.
+ */
+#ifndef SSD1322_CODE128_MAX
+#define SSD1322_CODE128_MAX 32        // başlangıç ve sağlama dahil sembol
+#endif
+
+#ifndef SSD1322_CODE128_LIGHT
+#define SSD1322_CODE128_LIGHT 3
+#endif
+
+/* ASCII 32..127 dışı karakter ya da sığmazsa false */
+bool SSD1322_Code128_Encode(const char *s);
+
+/* Sessiz bölge hariç modül genişliği (11 / sembol + 13 stop) */
+int  SSD1322_Code128_Modules(void);
+
+/*
+ * x, y, w, h kutusuna yatayda ortalar, yükseklik h. Ölçek = en büyük
+ * tamsayı ki kod + iki yanda quiet modül sığsın (gerekirse sessiz bölge
+ * daraltılır). Sığmazsa 0, yoksa ölçek döner.
+ */
+int  SSD1322_Code128_Draw(int x, int y, int w, int h, int quiet);
+
+#endif /* OLED_CODE128_H */
@@ -0,0 +1,369 @@
+/* oled_dlist.c */
+
+#include <string.h>
+#include "oled_dlist.h"
+
+#define DL_HDR 4u
+
+void SSD1322_DL_Init(ssd1322_dlist_t *dl, uint8_t *buf, uint16_t cap)
+{
+    dl->buf = buf;
+    dl->cap = cap;
+    SSD1322_DL_Reset(dl);
+}
+
+void SSD1322_DL_Reset(ssd1322_dlist_t *dl)
+{
+    dl->len = 0;
+    dl->overflow = false;
+}
+
+/* Kayıt başlığını yazar, payload için yer döner */
+static uint8_t *dl_put(ssd1322_dlist_t *dl, uint8_t op, uint8_t arg, uint16_t len)
+{
+    if ((uint32_t)dl->len + DL_HDR + len > dl->cap) {
+        dl->overflow = true;
+        return NULL;
+    }
+    uint8_t *p = dl->buf + dl->len;
+    p[0] = op;
+    p[1] = arg;
+    p[2] = (uint8_t)(len & 0xFF);
+    p[3] = (uint8_t)(len >> 8);
+    dl->len = (uint16_t)(dl->len + DL_HDR + len);
+    return p + DL_HDR;
+}
+
+static void put_i16(uint8_t *p, int n, const int *v)
+{
+    for (int i = 0; i < n; i++) {
+        int16_t t = (int16_t)v[i];
+        memcpy(p + 2 * i, &t, 2);
+    }
+}
+
+static int get_i16(const uint8_t *p, int i)
+{
+    int16_t t;
+    memcpy(&t, p + 2 * i, 2);
+    return t;
+}
+
+static bool dl_put_xy(ssd1322_dlist_t *dl, uint8_t op, uint8_t arg, int x, int y)
+{
+    uint8_t *p = dl_put(dl, op, arg, 4);
+    if (!p) return false;
+    put_i16(p, 2, (int[]){ x, y });
+    return true;
+}
+
+static bool dl_put_text(ssd1322_dlist_t *dl, uint8_t op, int x, int y, const char *s)
+{
+    size_t n = strlen(s);
+    if (n > 0xFFFF - 4) { dl->overflow = true; return false; }
+    uint8_t *p = dl_put(dl, op, 0, (uint16_t)(4 + n));
+    if (!p) return false;
+    put_i16(p, 2, (int[]){ x, y });
+    memcpy(p + 4, s, n);
+    return true;
+}
+
+bool SSD1322_DL_Clear(ssd1322_dlist_t *dl)
+{
+    return dl_put(dl, SSD1322_DL_CLEAR, 0, 0) != NULL;
+}
+
+bool SSD1322_DL_Pixel(ssd1322_dlist_t *dl, int x, int y, uint8_t gray)
+{
+    return dl_put_xy(dl, SSD1322_DL_PIXEL, gray, x, y);
+}
+
+bool SSD1322_DL_Char(ssd1322_dlist_t *dl, int x, int y, char c)
+{
+    return dl_put_xy(dl, SSD1322_DL_CHAR, (uint8_t)c, x, y);
+}
+
+bool SSD1322_DL_Text(ssd1322_dlist_t *dl, int x, int y, const char *s)
+{
+    return dl_put_text(dl, SSD1322_DL_TEXT, x, y, s);
+}
+
+bool SSD1322_DL_TextCentered(ssd1322_dlist_t *dl, const char *s, int y)
+{
+    return dl_put_text(dl, SSD1322_DL_TEXT_CENTERED, 0, y, s);
+}
+
+bool SSD1322_DL_FillRect(ssd1322_dlist_t *dl, int x, int y, int w, int h, uint8_t gray)
+{
+    uint8_t *p = dl_put(dl, SSD1322_DL_FILL_RECT, gray, 8);
+    if (!p) return false;
+    put_i16(p, 4, (int[]){ x, y, w, h });
+    return true;
+}
+
+/* Sprite tanımlayıcısı alan alan yazılır: dolgu byte'ı yok, DL_Equal'ın memcmp'i tutarlı */
+#define DL_SPR_PTRS (2 * sizeof(const uint8_t *))
+#define DL_SPR_LEN  (DL_SPR_PTRS + 12)
+
+static void put_sprite(uint8_t *p, const ssd1322_sprite_t *spr)
+{
+    uint16_t v[5] = { spr->x0, spr->w, spr->h, spr->stride, spr->mask_stride };
+    memcpy(p, &spr->data, sizeof(spr->data));
+    memcpy(p + sizeof(spr->data), &spr->mask, sizeof(spr->mask));
+    memcpy(p + DL_SPR_PTRS, v, sizeof(v));
+    p[DL_SPR_PTRS + 10] = spr->bpp;
+    p[DL_SPR_PTRS + 11] = spr->key;
+}
+
+static void get_sprite(const uint8_t *p, ssd1322_sprite_t *spr)
+{
+    uint16_t v[5];
+    memcpy(&spr->data, p, sizeof(spr->data));
+    memcpy(&spr->mask, p + sizeof(spr->data), sizeof(spr->mask));
+    memcpy(v, p + DL_SPR_PTRS, sizeof(v));
+    spr->x0 = v[0];
+    spr->w = v[1];
+    spr->h = v[2];
+    spr->stride = v[3];
+    spr->mask_stride = v[4];
+    spr->bpp = p[DL_SPR_PTRS + 10];
+    spr->key = p[DL_SPR_PTRS + 11];
+}
+
+bool SSD1322_DL_Sprite(ssd1322_dlist_t *dl, int x, int y, const ssd1322_sprite_t *spr)
+{
+    static const ssd1322_sprite_t none;   // NULL: boş kayıt, çizmez
+    uint8_t *p = dl_put(dl, SSD1322_DL_SPRITE, 0, (uint16_t)(4 + DL_SPR_LEN));
+    if (!p) return false;
+    put_i16(p, 2, (int[]){ x, y });
+    put_sprite(p + 4, spr ? spr : &none);
+    return true;
+}
+
+/* draw_centered_at_y ile aynı yerleşim */
+static int centered_x0(int len)
+{
+    int x0 = (128 - SSD1322_FontTextWidth(SSD1322_GetFont(), len)) / 2;
+    return x0 < 0 ? 0 : x0;
+}
+
+/* payload içindeki UTF-8 metnin kod noktası sayısı */
+static int text_len(const uint8_t *p, int n)
+{
+    const char *s = (const char *)p, *end = s + n;
+    int count = 0;
+    while (SSD1322_Utf8Next(&s, end)) count++;
+    return count;
+}
+
+static void dl_exec(const uint8_t *rec)
+{
+    const uint8_t *p = rec + DL_HDR;
+    int len = rec[2] | (rec[3] << 8);
+
+    switch (rec[0]) {
+        case SSD1322_DL_CLEAR:
+            SSD1322_ClearFramebuffer();
+            break;
+        case SSD1322_DL_PIXEL:
+            SSD1322_SetPixel(get_i16(p, 0), get_i16(p, 1), rec[1]);
+            break;
+        case SSD1322_DL_CHAR:
+            SSD1322_DrawChar(get_i16(p, 0), get_i16(p, 1), (char)rec[1]);
+            break;
+        case SSD1322_DL_TEXT:
+        case SSD1322_DL_TEXT_CENTERED: {
+            const char *t = (const char *)p + 4, *end = (const char *)p + len;
+            int x = rec[0] == SSD1322_DL_TEXT ? get_i16(p, 0) : centered_x0(text_len(p + 4, len - 4));
+            int y = get_i16(p, 1);
+            uint32_t cp;
+            while ((cp = SSD1322_Utf8Next(&t, end)) != 0) {
+                SSD1322_DrawGlyph(x, y, cp);
+                x += SSD1322_GetFont()->advance;
+            }
+            break;
+        }
+        case SSD1322_DL_FILL_RECT:
+            SSD1322_FillRect(get_i16(p, 0), get_i16(p, 1), get_i16(p, 2), get_i16(p, 3), rec[1]);
+            break;
+        case SSD1322_DL_SPRITE: {
+            ssd1322_sprite_t spr;
+            get_sprite(p + 4, &spr);
+            SSD1322_DrawSprite(get_i16(p, 0), get_i16(p, 1), &spr);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+static uint16_t rec_size(const uint8_t *rec)
+{
+    return (uint16_t)(DL_HDR + (rec[2] | (rec[3] << 8)));
+}
+
+void SSD1322_DL_Draw(const ssd1322_dlist_t *dl)
+{
+    for (uint16_t off = 0; off + DL_HDR <= dl->len; off += rec_size(dl->buf + off))
+        dl_exec(dl->buf + off);
+}
+
+bool SSD1322_DL_Equal(const ssd1322_dlist_t *a, const ssd1322_dlist_t *b)
+{
+    return a->len == b->len && memcmp(a->buf, b->buf, a->len) == 0;
+}
+
+#ifndef SSD1322_NO_FRAMEBUFFER
+
+typedef struct { int16_t x0, y0, x1, y1; } dl_rect_t;   // dahil
+
+/* Kaydın etkilediği alan; boşsa false */
+static bool dl_bbox(const uint8_t *rec, dl_rect_t *r)
+{
+    const uint8_t *p = rec + DL_HDR;
+    int len = rec[2] | (rec[3] << 8);
+    int x = 0, y = 0, w = 0, h = 0;
+
+    switch (rec[0]) {
+        case SSD1322_DL_CLEAR:
+            w = SSD1322_WIDTH; h = SSD1322_HEIGHT;
+            break;
+        case SSD1322_DL_PIXEL:
+            x = get_i16(p, 0); y = get_i16(p, 1); w = 1; h = 1;
+            break;
+        case SSD1322_DL_CHAR:
+            x = get_i16(p, 0); y = get_i16(p, 1); w = SSD1322_GetFont()->w; h = SSD1322_GetFont()->h;
+            break;
+        case SSD1322_DL_TEXT:
+        case SSD1322_DL_TEXT_CENTERED: {
+            int n = text_len(p + 4, len - 4);
+            x = rec[0] == SSD1322_DL_TEXT ? get_i16(p, 0) : centered_x0(n);
+            y = get_i16(p, 1); w = SSD1322_FontTextWidth(SSD1322_GetFont(), n); h = SSD1322_GetFont()->h;
+            break;
+        }
+        case SSD1322_DL_FILL_RECT:
+            x = get_i16(p, 0); y = get_i16(p, 1); w = get_i16(p, 2); h = get_i16(p, 3);
+            break;
+        case SSD1322_DL_SPRITE: {
+            ssd1322_sprite_t spr;
+            get_sprite(p + 4, &spr);
+            x = get_i16(p, 0); y = get_i16(p, 1); w = spr.w; h = spr.h;
+            break;
+        }
+        default:
+            return false;
+    }
+
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > SSD1322_WIDTH)  w = SSD1322_WIDTH - x;
+    if (y + h > SSD1322_HEIGHT) h = SSD1322_HEIGHT - y;
+    if (w <= 0 || h <= 0) return false;
+
+    r->x0 = (int16_t)x;
+    r->y0 = (int16_t)y;
+    r->x1 = (int16_t)(x + w - 1);
+    r->y1 = (int16_t)(y + h - 1);
+    return true;
+}
+
+static int rect_area(const dl_rect_t *r)
+{
+    return (r->x1 - r->x0 + 1) * (r->y1 - r->y0 + 1);
+}
+
+static void rect_union(dl_rect_t *a, const dl_rect_t *b)
+{
+    if (b->x0 < a->x0) a->x0 = b->x0;
+    if (b->y0 < a->y0) a->y0 = b->y0;
+    if (b->x1 > a->x1) a->x1 = b->x1;
+    if (b->y1 > a->y1) a->y1 = b->y1;
+}
+
+static bool rect_overlap(const dl_rect_t *a, const dl_rect_t *b)
+{
+    return a->x0 <= b->x1 && b->x0 <= a->x1 && a->y0 <= b->y1 && b->y0 <= a->y1;
+}
+
+/* Listeye ekler; yer yoksa en az büyüyen dikdörtgenle birleştirir */
+static void rects_add(dl_rect_t *rects, int *n, const dl_rect_t *r)
+{
+    for (int i = 0; i < *n; i++) {
+        if (rect_overlap(&rects[i], r)) { rect_union(&rects[i], r); return; }
+    }
+    if (*n < SSD1322_DL_MAX_RECTS) { rects[(*n)++] = *r; return; }
+
+    int best = 0, best_cost = 0x7FFFFFFF;
+    for (int i = 0; i < *n; i++) {
+        dl_rect_t u = rects[i];
+        rect_union(&u, r);
+        int cost = rect_area(&u) - rect_area(&rects[i]);
+        if (cost < best_cost) { best_cost = cost; best = i; }
+    }
+    rect_union(&rects[best], r);
+}
+
+static void rects_add_rec(dl_rect_t *rects, int *n, const uint8_t *rec)
+{
+    dl_rect_t r;
+    if (dl_bbox(rec, &r)) rects_add(rects, n, &r);
+}
+
+bool SSD1322_DL_Present(const ssd1322_dlist_t *dl, ssd1322_dlist_t *last)
+{
+    if (dl->overflow) return false;   // eksik liste: ekran son tam listede kalır
+    if (last->len && SSD1322_DL_Equal(dl, last)) return false;
+
+    dl_rect_t rects[SSD1322_DL_MAX_RECTS];
+    int n = 0;
+
+    if (!last->len) {
+        dl_rect_t all = { 0, 0, SSD1322_WIDTH - 1, SSD1322_HEIGHT - 1 };
+        rects[n++] = all;
+    } else {
+        /* kayıt kayıt karşılaştır; farklı olanların eski ve yeni alanları kirli */
+        uint16_t a = 0, b = 0;
+        while (a + DL_HDR <= dl->len || b + DL_HDR <= last->len) {
+            const uint8_t *ra = a + DL_HDR <= dl->len   ? dl->buf + a   : NULL;
+            const uint8_t *rb = b + DL_HDR <= last->len ? last->buf + b : NULL;
+            uint16_t sa = ra ? rec_size(ra) : 0;
+            uint16_t sb = rb ? rec_size(rb) : 0;
+
+            if (!(ra && rb && sa == sb && memcmp(ra, rb, sa) == 0)) {
+                if (ra) rects_add_rec(rects, &n, ra);
+                if (rb) rects_add_rec(rects, &n, rb);
+            }
+            a = (uint16_t)(a + sa);
+            b = (uint16_t)(b + sb);
+        }
+    }
+
+    /* her kirli alanı temizle ve o alana değen kayıtları sırayla yeniden çiz */
+    ssd1322_surface_t *prev = ssd1322_target;
+    SSD1322_SetTarget(NULL);
+    for (int i = 0; i < n; i++) {
+        const dl_rect_t *r = &rects[i];
+        SSD1322_SetClip(r->x0, r->y0, r->x1, r->y1);
+        SSD1322_ClearFramebuffer();
+        for (uint16_t off = 0; off + DL_HDR <= dl->len; off += rec_size(dl->buf + off)) {
+            dl_rect_t bb;
+            if (dl_bbox(dl->buf + off, &bb) && rect_overlap(&bb, r))
+                dl_exec(dl->buf + off);
+        }
+        SSD1322_MarkDirty(r->x0, r->y0, r->x1, r->y1);
+    }
+    SSD1322_ResetClip();
+    SSD1322_SetTarget(prev);
+    SSD1322_RefreshDirty();
+
+    /* son çalıştırılan liste olarak sakla */
+    if (dl->len <= last->cap) {
+        memcpy(last->buf, dl->buf, dl->len);
+        last->len = dl->len;
+    } else {
+        last->len = 0;   // saklanamadı, sonraki Present tam çizer
+    }
+    return true;
+}
+
+#endif
@@ -0,0 +1,74 @@
+/* oled_dlist.h */
+
+#ifndef OLED_DLIST_H
+#define OLED_DLIST_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oled_ssd1322.h"
+#include "oled_sprite.h"
+
+/*
+ * Kaydedilebilir display list.
+ * Çizim işlemleri kompakt kayıtlar olarak bir tampona yazılır
+ * (4 byte başlık: op, arg, len16 + payload). Liste olduğu gibi saklanabilir,
+ * karşılaştırılabilir ve tekrar oynatılabilir.
+ *
+ * SSD1322_DL_Present(): son çalıştırılan listeyle aynıysa hiçbir şey yapmaz;
+ * farklıysa sadece değişen kayıtların kapsadığı bölgeleri yeniden çizer,
+ * kirli işaretler ve gönderir.
+ *
+ * Sprite kayıtları tanımlayıcıyı değer olarak taşır (çağıranın kopyası
+ * sonradan değişebilir), piksel / maske verisi ise pointer'dır: tampon bu
+ * işlemler için cihaz dışına taşınabilir değildir.
+ */
+
+enum {
+    SSD1322_DL_CLEAR = 1,         // tüm hedef
+    SSD1322_DL_PIXEL,             // arg=gri, x,y
+    SSD1322_DL_CHAR,              // arg=karakter, x,y
+    SSD1322_DL_TEXT,              // x,y, string (7 px adım)
+    SSD1322_DL_TEXT_CENTERED,     // y, string (draw_centered_at_y)
+    SSD1322_DL_FILL_RECT,         // arg=gri, x,y,w,h
+    SSD1322_DL_SPRITE,            // x,y, sprite tanımlayıcısı (değer olarak)
+};
+
+typedef struct {
+    uint8_t *buf;
+    uint16_t cap;
+    uint16_t len;
+    bool     overflow;            // kayıt sığmadı, liste eksik
+} ssd1322_dlist_t;
+
+/* Present'in aynı anda ele alacağı en fazla kirli dikdörtgen (fazlası birleşir) */
+#ifndef SSD1322_DL_MAX_RECTS
+#define SSD1322_DL_MAX_RECTS 8
+#endif
+
+void SSD1322_DL_Init(ssd1322_dlist_t *dl, uint8_t *buf, uint16_t cap);
+void SSD1322_DL_Reset(ssd1322_dlist_t *dl);
+
+bool SSD1322_DL_Clear(ssd1322_dlist_t *dl);
+bool SSD1322_DL_Pixel(ssd1322_dlist_t *dl, int x, int y, uint8_t gray);
+bool SSD1322_DL_Char(ssd1322_dlist_t *dl, int x, int y, char c);
+bool SSD1322_DL_Text(ssd1322_dlist_t *dl, int x, int y, const char *s);
+bool SSD1322_DL_TextCentered(ssd1322_dlist_t *dl, const char *s, int y);
+bool SSD1322_DL_FillRect(ssd1322_dlist_t *dl, int x, int y, int w, int h, uint8_t gray);
+bool SSD1322_DL_Sprite(ssd1322_dlist_t *dl, int x, int y, const ssd1322_sprite_t *spr);
+
+/* Listeyi aktif hedefe çizer (band renderer callback'i olarak da kullanılabilir) */
+void SSD1322_DL_Draw(const ssd1322_dlist_t *dl);
+
+bool SSD1322_DL_Equal(const ssd1322_dlist_t *a, const ssd1322_dlist_t *b);
+
+#ifndef SSD1322_NO_FRAMEBUFFER
+/*
+ * dl'i framebuf'a uygular: last ile farkları çizer ve sadece onları gönderir,
+ * sonra dl'i last'a kopyalar. Değişen bir şey yoksa false döner; dl->overflow
+ * ise (liste eksik) hiçbir şey çizilmeden false döner, last değişmez.
+ * last->cap >= dl->len olmalı; ilk çağrıda last boş bırakılırsa tam çizim yapılır.
+ */
+bool SSD1322_DL_Present(const ssd1322_dlist_t *dl, ssd1322_dlist_t *last);
+#endif
+
+#endif /* OLED_DLIST_H */
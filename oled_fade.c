@@ -0,0 +1,156 @@
+/* oled_fade.c */
+
+#include "oled_fade.h"
+
+typedef struct {
+    uint8_t  to;
+    uint32_t ms;
+    ssd1322_fade_cb cb;     // segment bitince (hedef seviyedeyken) çağrılır
+    void    *ctx;
+} fade_seg_t;
+
+static fade_seg_t fade_q[SSD1322_FADE_QUEUE];
+static uint8_t  fade_head, fade_count;
+static bool     seg_running;
+static uint8_t  seg_from;
+static uint32_t seg_start;
+
+static uint8_t  level = SSD1322_CONTRAST_DEFAULT;
+static int16_t  hw_c1 = -1, hw_master = -1;   // register'daki değer (-1 = bilinmiyor)
+static uint32_t last_write;
+
+static bool     pulse;
+static uint8_t  pulse_lo, pulse_hi;
+static uint32_t pulse_half;
+
+/*
+ * Seviye -> register. 16 altında master 0 ve 16 kat çözünürlük:
+ * akım ~ c1 * (master + 1) / 16.
+ */
+static void fade_write(uint32_t now, bool force)
+{
+    if (!force && (uint32_t)(now - last_write) < SSD1322_FADE_STEP_MS) return;
+
+    uint8_t m  = level < 16 ? 0 : 15;
+    uint8_t c1 = level < 16 ? (uint8_t)(level * 16) : level;
+
+    if (m != hw_master) { SSD1322_SetMasterContrast(m); hw_master = m; }
+    if (c1 != hw_c1)    { SSD1322_SetContrast(c1);      hw_c1 = c1; }
+    last_write = now;
+}
+
+static uint16_t isqrt16(uint32_t v)
+{
+    uint32_t r = 0;
+    for (uint32_t b = 1u << 14; b; b >>= 1) {
+        if ((r + b) * (r + b) <= v) r += b;
+    }
+    return (uint16_t)r;
+}
+
+/* Algısal (yaklaşık karekök) uzayda doğrusal geçiş */
+static uint8_t fade_interp(uint8_t from, uint8_t to, uint32_t el, uint32_t ms)
+{
+    int32_t pf = isqrt16((uint32_t)from << 8);
+    int32_t pt = isqrt16((uint32_t)to << 8);
+    int32_t p = pf + (int32_t)(((int64_t)(pt - pf) * el) / ms);
+    return (uint8_t)(((uint32_t)(p * p)) >> 8);
+}
+
+static void fade_push(uint8_t to, uint32_t ms, ssd1322_fade_cb cb, void *ctx)
+{
+    if (fade_count == SSD1322_FADE_QUEUE) return;   // kuyruk dolu, istek düşer
+    fade_seg_t *s = &fade_q[(fade_head + fade_count) % SSD1322_FADE_QUEUE];
+    s->to = to;
+    s->ms = ms;
+    s->cb = cb;
+    s->ctx = ctx;
+    fade_count++;
+}
+
+void SSD1322_Fade_Init(void)
+{
+    fade_head = fade_count = 0;
+    seg_running = false;
+    pulse = false;
+    level = SSD1322_CONTRAST_DEFAULT;
+    hw_c1 = SSD1322_CONTRAST_DEFAULT;
+    hw_master = SSD1322_MASTER_CONTRAST_DEFAULT;
+}
+
+void SSD1322_Fade_To(uint8_t to, uint32_t ms)
+{
+    fade_push(to, ms, 0, 0);
+}
+
+void SSD1322_Fade_In(uint32_t ms)
+{
+    fade_push(SSD1322_CONTRAST_DEFAULT, ms, 0, 0);
+}
+
+void SSD1322_Fade_Out(uint32_t ms)
+{
+    fade_push(0, ms, 0, 0);
+}
+
+void SSD1322_Fade_Pulse(uint8_t lo, uint8_t hi, uint32_t period_ms)
+{
+    pulse = true;
+    pulse_lo = lo;
+    pulse_hi = hi;
+    pulse_half = period_ms / 2;
+    fade_push(hi, pulse_half, 0, 0);
+}
+
+void SSD1322_Fade_Transition(ssd1322_fade_cb swap, void *ctx, uint32_t out_ms, uint32_t in_ms)
+{
+    fade_push(0, out_ms, swap, ctx);
+    fade_push(SSD1322_CONTRAST_DEFAULT, in_ms, 0, 0);
+}
+
+void SSD1322_Fade_Stop(void)
+{
+    fade_head = fade_count = 0;
+    seg_running = false;
+    pulse = false;
+}
+
+uint8_t SSD1322_Fade_Level(void)
+{
+    return level;
+}
+
+bool SSD1322_Fade_Tick(uint32_t now_ms)
+{
+    if (!fade_count) return false;
+
+    fade_seg_t *s = &fade_q[fade_head];
+    if (!seg_running) {
+        seg_running = true;
+        seg_start = now_ms;
+        seg_from = level;
+    }
+
+    uint32_t el = now_ms - seg_start;
+    if (el < s->ms) {
+        level = fade_interp(seg_from, s->to, el, s->ms);
+        fade_write(now_ms, false);
+        return true;
+    }
+
+    /* segment bitti: hedef değeri kesin yaz, callback, sıradaki */
+    level = s->to;
+    fade_write(now_ms, true);
+
+    ssd1322_fade_cb cb = s->cb;
+    void *ctx = s->ctx;
+    fade_head = (uint8_t)((fade_head + 1) % SSD1322_FADE_QUEUE);
+    fade_count--;
+    seg_running = false;
+
+    if (cb) cb(ctx);
+    if (pulse && !fade_count)
+        fade_push(level == pulse_hi ? pulse_lo : pulse_hi, pulse_half, 0, 0);
+
+    return fade_count != 0;
+}
@@ -0,0 +1,44 @@
+/* oled_fade.h */
+
+#ifndef OLED_FADE_H
+#define OLED_FADE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oled_ssd1322.h"
+
+/*
+ * Kontrast register'ları ile donanım fade'i.
+ * Parlaklık seviyesi 0..255 (0xC1 birimi, master 15'te); 0xC1 ve düşük
+ * seviyelerde 0xC7 adım adım yazılır, her adım en fazla iki komut.
+ * GDDRAM'a ve framebuf'a dokunulmaz.
+ *
+ * SSD1322_Fade_Tick(HAL_GetTick()) bir timer ya da ana döngüden çağrılır.
+ * Segmentler sıraya girer: Out + swap + In zinciri tek çağrıyla kurulur.
+ */
+
+/* Register yazımları arasındaki en kısa süre (SPI bütçesi) */
+#ifndef SSD1322_FADE_STEP_MS
+#define SSD1322_FADE_STEP_MS 16u
+#endif
+
+#ifndef SSD1322_FADE_QUEUE
+#define SSD1322_FADE_QUEUE 4
+#endif
+
+typedef void (*ssd1322_fade_cb)(void *ctx);
+
+void SSD1322_Fade_Init(void);                               // seviye = SSD1322_CONTRAST_DEFAULT
+void SSD1322_Fade_To(uint8_t level, uint32_t ms);            // sıraya ekler
+void SSD1322_Fade_In(uint32_t ms);                          // -> SSD1322_CONTRAST_DEFAULT
+void SSD1322_Fade_Out(uint32_t ms);                         // -> 0
+void SSD1322_Fade_Pulse(uint8_t lo, uint8_t hi, uint32_t period_ms);   // Stop'a kadar sürer
+
+/* Karart, karanlıkta swap(ctx) çağır (ör. yeni ekranı gönder), geri aç */
+void SSD1322_Fade_Transition(ssd1322_fade_cb swap, void *ctx, uint32_t out_ms, uint32_t in_ms);
+
+void SSD1322_Fade_Stop(void);                               // kuyruk ve pulse iptal, seviye kalır
+bool SSD1322_Fade_Tick(uint32_t now_ms);                     // aktifse true
+uint8_t SSD1322_Fade_Level(void);
+
+#endif /* OLED_FADE_H */
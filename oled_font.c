@@ -0,0 +1,40 @@
+/* oled_font.c */
+
+#include "oled_font.h"
+
+uint32_t SSD1322_Utf8Next(const char **s, const char *end)
+{
+    const uint8_t *p = (const uint8_t *)*s;
+    const uint8_t *e = (const uint8_t *)end;
+
+    if (e ? p >= e : *p == 0) return 0;
+
+    uint32_t c = *p++;
+    int extra;
+    if (c < 0x80)                { *s = (const char *)p; return c; }
+    else if ((c & 0xE0) == 0xC0) { extra = 1; c &= 0x1F; }
+    else if ((c & 0xF0) == 0xE0) { extra = 2; c &= 0x0F; }
+    else if ((c & 0xF8) == 0xF0) { extra = 3; c &= 0x07; }
+    else                         { *s = (const char *)p; return 0xFFFD; }
+
+    for (int i = 0; i < extra; i++) {
+        if ((e && p >= e) || (*p & 0xC0) != 0x80) {   // eksik devam byte'ı
+            *s = (const char *)p;
+            return 0xFFFD;
+        }
+        c = (c << 6) | (*p++ & 0x3F);
+    }
+    *s = (const char *)p;
+
+    /* uzun kodlama (ör. C0 80 = 0), surrogate ve U+10FFFF ötesi geçersiz */
+    static const uint32_t min_cp[4] = { 0, 0x80, 0x800, 0x10000 };
+    if (c < min_cp[extra] || (c >= 0xD800 && c <= 0xDFFF) || c > 0x10FFFF) return 0xFFFD;
+    return c;
+}
+
+int SSD1322_Utf8Length(const char *s)
+{
+    int n = 0;
+    while (SSD1322_Utf8Next(&s, 0)) n++;
+    return n;
+}
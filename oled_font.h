@@ -0,0 +1,68 @@
+/* oled_font.h */
+
+#ifndef OLED_FONT_H
+#define OLED_FONT_H
+
+#include <stdint.h>
+
+/*
+ * Genişletilmiş font formatı (tools/bdf2font ile üretilir).
+ * Kod noktaları 128'lik bloklara bölünür. block_map[cp >> 7] blok indeksini,
+ * bloğun 128 bitlik varlık bitmap'i ve rank[] değerleri glifin blok içindeki
+ * sırasını verir: arama sabit zamanlıdır (bir tablo + bir popcount).
+ *
+ * Glif düzeni Font6x8 ile aynı: kolon kolon, kolon başına col_bytes byte,
+ * LSB = üst satır.
+ */
+typedef struct {
+    uint32_t present[4];          // blok içindeki kod noktaları (bit = cp & 127)
+    uint8_t  rank[4];             // present[i]'den önce gelen glif sayısı
+    const uint8_t *glyphs;        // bu bloğun glifleri, kod noktası sırasıyla
+} ssd1322_font_block_t;
+
+typedef struct {
+    const uint8_t *block_map;     // cp >> 7 -> blocks[] indeksi, 0xFF = yok
+    const ssd1322_font_block_t *blocks;
+    uint16_t map_len;
+    uint8_t  w, h;                // glif hücresi (h <= 16)
+    uint8_t  advance;             // karakter adımı (glif + boşluk)
+    uint8_t  col_bytes;           // (h + 7) / 8
+    uint16_t fallback;            // olmayan kod noktası yerine çizilen ('?')
+} ssd1322_font_t;
+
+#define SSD1322_FONT_NO_BLOCK 0xFF
+
+/* ASCII + Türkçe (ç ğ ı İ ö ş ü, büyükleri) + derece işareti, 6x8 */
+extern const ssd1322_font_t Font6x8_TR;
+
+/* Glif verisi ya da NULL, O(1) */
+static inline const uint8_t *SSD1322_FontGlyph(const ssd1322_font_t *f, uint32_t cp)
+{
+    uint32_t b = cp >> 7;
+    if (b >= f->map_len || f->block_map[b] == SSD1322_FONT_NO_BLOCK) return 0;
+
+    const ssd1322_font_block_t *blk = &f->blocks[f->block_map[b]];
+    uint32_t bit = cp & 127u, word = bit >> 5, mask = 1u << (bit & 31u);
+    if (!(blk->present[word] & mask)) return 0;
+
+    uint32_t idx = blk->rank[word] + (uint32_t)__builtin_popcount(blk->present[word] & (mask - 1u));
+    return blk->glyphs + idx * f->w * f->col_bytes;
+}
+
+/* n karakterlik tek satırın piksel genişliği (son karakterden sonra boşluk yok) */
+static inline int SSD1322_FontTextWidth(const ssd1322_font_t *f, int n)
+{
+    return n > 0 ? n * f->advance - (f->advance - f->w) : 0;
+}
+
+/*
+ * Sıradaki UTF-8 kod noktasını çözer ve *s'yi ilerletir.
+ * end NULL ise NUL'da durur (0 döner). Bozuk, uzun kodlanmış (ör. C0 80),
+ * surrogate ya da U+10FFFF ötesi dizi U+FFFD verir (çizimde yedek glif).
+ */
+uint32_t SSD1322_Utf8Next(const char **s, const char *end);
+
+/* Kod noktası sayısı */
+int SSD1322_Utf8Length(const char *s);
+
+#endif /* OLED_FONT_H */
@@ -0,0 +1,1032 @@
+/* tools/ssd1322_bake ile üretildi: NHD_Logo (oled_images.c, 128x64 4bpp @ 0,0) */
+
+#include "oled_wire.h"
+
+const uint8_t NHD_Logo_Wire[16401] = {
+0x01, 0x03, 0x15, 0x00, 0x7F, 0x01, 0x03, 0x75, 0x00, 0x3F, 0x01, 0x01, 0x5C, 0x02, 0x00, 0x40,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xCC, 0xCC,
+0xBB, 0xBB, 0xBB, 0xBB, 0xCC, 0xCC, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xDD, 0xDD, 0x99, 0x99, 0x55, 0x55, 0x22, 0x22, 0x11, 0x11, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x22, 0x22, 0x55, 0x55, 0x99, 0x99, 0xCC, 0xCC,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE,
+0xAA, 0xAA, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x33, 0x33, 0x88, 0x88, 0xDD, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x33, 0x33,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x88, 0x88, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xDD, 0xDD, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xAA, 0xAA, 0xFF, 0xFF, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xAA, 0xAA, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x55, 0x55, 0x88, 0x88,
+0xAA, 0xAA, 0xBB, 0xBB, 0xCC, 0xCC, 0xCC, 0xCC, 0xBB, 0xBB, 0x99, 0x99, 0x77, 0x77, 0x44, 0x44,
+0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0xEE, 0xEE,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x66, 0x66, 0xBB, 0xBB, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xAA, 0xAA, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33,
+0xDD, 0xDD, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xFF, 0xFF, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x11, 0x11, 0x77, 0x77, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xCC, 0xCC, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x22, 0x22, 0xCC, 0xCC, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF,
+0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66,
+0xDD, 0xDD, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xCC, 0xCC, 0x55, 0x55, 0x00, 0x00,
+0x00, 0x00, 0x11, 0x11, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0x77, 0x77,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xAA, 0xAA, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+0x11, 0x11, 0x00, 0x00, 0x22, 0x22, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0xDD, 0xDD, 0xFF, 0xFF, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0x44, 0x44, 0x00, 0x00, 0x55, 0x55, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xCC, 0xCC, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0x66, 0x66, 0x00, 0x00, 0x88, 0x88, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0x66, 0x66, 0x00, 0x00, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xFF, 0xFF, 0x44, 0x44, 0x44, 0x44, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xCC, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x33, 0x33, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0x33, 0x33, 0xBB, 0xBB, 0xEE, 0xEE,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xCC, 0xCC, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xFF, 0xFF, 0xBB, 0xBB, 0x66, 0x66, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77,
+0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0x77, 0x77, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xEE, 0xEE, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0xEE, 0xEE,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xBB, 0xBB, 0xAA, 0xAA,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xCC, 0xCC,
+0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0x99, 0x99, 0x33, 0x33, 0x22, 0x22,
+0x22, 0x22, 0x11, 0x11, 0x11, 0x11, 0xBB, 0xBB, 0x33, 0x33, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+0x44, 0x44, 0xCC, 0xCC, 0xFF, 0xFF, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xEE, 0xEE, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xDD, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0x66, 0x66, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x99, 0x99, 0xEE, 0xEE, 0xEE, 0xEE, 0xCC, 0xCC, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0xDD, 0xDD, 0xFF, 0xFF, 0xEE, 0xEE, 0x99, 0x99, 0x22, 0x22, 0x22, 0x22,
+0x99, 0x99, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x11, 0x11, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x11, 0x11, 0xDD, 0xDD, 0xEE, 0xEE, 0xCC, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xBB, 0xBB, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xDD, 0xDD, 0xFF, 0xFF, 0xEE, 0xEE, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x55, 0x55, 0xEE, 0xEE, 0xEE, 0xEE, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x66, 0x66, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xDD, 0xDD,
+0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0x77, 0x77, 0x99, 0x99, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xFF, 0xFF, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x33, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xDD, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x88, 0x88, 0xEE, 0xEE, 0xEE, 0xEE, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x44, 0x44, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xAA, 0xAA, 0x77, 0x77, 0x77, 0x77,
+0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xCC, 0xCC, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0x88, 0x88,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0xFF, 0xFF, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x77, 0x77, 0xFF, 0xFF, 0xEE, 0xEE, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xCC, 0xCC, 0xEE, 0xEE, 0xEE, 0xEE, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x66, 0x66, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x44, 0x44, 0xDD, 0xDD, 0xEE, 0xEE, 0xDD, 0xDD, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0x55, 0x55,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xFF, 0xFF, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xCC, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xAA, 0xAA, 0xEE, 0xEE, 0xEE, 0xEE, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x22, 0x22, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xCC, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xCC, 0xCC, 0xEE, 0xEE, 0xEE, 0xEE, 0xCC, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF,
+0xEE, 0xEE, 0xFF, 0xFF, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xBB, 0xBB, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0x22, 0x22,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0xDD, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xEE, 0xEE, 0xFF, 0xFF, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x55, 0x55, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xAA, 0xAA, 0x22, 0x22, 0x22, 0x22,
+0xAA, 0xAA, 0xFF, 0xFF, 0xDD, 0xDD, 0xEE, 0xEE, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x22, 0x22, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xBB, 0xBB, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xEE, 0xEE, 0xFF, 0xFF, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33,
+0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x88, 0x88, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xDD, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33,
+0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x99, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77,
+0xFF, 0xFF, 0xEE, 0xEE, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xBB, 0xBB, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x11, 0x11, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55,
+0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x99, 0x99, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xDD, 0xDD, 0xCC, 0xCC, 0xCC, 0xCC,
+0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC,
+0xDD, 0xDD, 0xCC, 0xCC, 0xCC, 0xCC, 0xDD, 0xDD, 0xBB, 0xBB, 0xBB, 0xBB, 0x44, 0x44, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0xBB, 0xBB, 0xCC, 0xCC, 0xEE, 0xEE,
+0xFF, 0xFF, 0xCC, 0xCC, 0x88, 0x88, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x88, 0x88, 0xDD, 0xDD, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xCC, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99,
+0xFF, 0xFF, 0xFF, 0xFF, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22,
+0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xAA, 0xAA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xAA, 0xAA,
+0xDD, 0xDD, 0xCC, 0xCC, 0xBB, 0xBB, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x33, 0x33, 0xBB, 0xBB, 0xAA, 0xAA, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0x99, 0x99,
+0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+0x77, 0x77, 0xAA, 0xAA, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xFF, 0xFF, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x11, 0x11, 0xCC, 0xCC, 0xEE, 0xEE, 0xEE, 0xEE, 0x66, 0x66, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0xCC, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0xFF, 0xFF,
+0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC,
+0xEE, 0xEE, 0xFF, 0xFF, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55,
+0xFF, 0xFF, 0xEE, 0xEE, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xCC, 0xCC, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0xEE, 0xEE, 0xCC, 0xCC, 0x22, 0x22, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xFF, 0xFF, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
+0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xCC, 0xCC, 0xCC, 0xCC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+0xCC, 0xCC, 0xEE, 0xEE, 0xEE, 0xEE, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xAA, 0xAA,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0xFF, 0xFF, 0xEE, 0xEE,
+0xEE, 0xEE, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99,
+0xFF, 0xFF, 0xFF, 0xFF, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
+0xDD, 0xDD, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xEE, 0xEE, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xDD, 0xFF, 0xFF, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xFF, 0xFF, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x77, 0x77, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x11, 0x11, 0xEE, 0xEE, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xEE, 0xEE, 0x11, 0x11,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xDD, 0xEE, 0xEE,
+0xEE, 0xEE, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0xEE, 0xEE,
+0xFF, 0xFF, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC,
+0xEE, 0xEE, 0xEE, 0xEE, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55,
+0xDD, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xBB, 0xBB, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xEE, 0xEE, 0xFF, 0xFF, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x44, 0x44, 0xFF, 0xFF, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0xDD, 0xDD, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xFF, 0xFF,
+0xCC, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xFF, 0xFF,
+0xFF, 0xFF, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xDD, 0xDD,
+0xEE, 0xEE, 0xDD, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99,
+0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xDD, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x22, 0x22, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xDD, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
+0xAA, 0xAA, 0xDD, 0xDD, 0xDD, 0xDD, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x88, 0x88, 0xEE, 0xEE, 0xAA, 0xAA, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x99, 0x99, 0x99, 0x99, 0xDD, 0xDD, 0x99, 0x99, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xAA, 0xAA, 0xBB, 0xBB, 0x99, 0x99,
+0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0xCC, 0xCC, 0xFF, 0xFF,
+0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xDD, 0xFF, 0xFF,
+0xEE, 0xEE, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xEE, 0xEE,
+0xEE, 0xEE, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC,
+0xDD, 0xDD, 0xAA, 0xAA, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x66, 0x66, 0xAA, 0xAA, 0xAA, 0xAA, 0xDD, 0xDD, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x11, 0x11, 0x88, 0x88, 0xBB, 0xBB, 0xAA, 0xAA, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xCC, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA,
+0xFF, 0xFF, 0xDD, 0xDD, 0xFF, 0xFF, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xBB, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0xCC, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0x55, 0x55, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xDD, 0xDD, 0xFF, 0xFF,
+0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xFF, 0xFF, 0xFF, 0xFF,
+0xDD, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0xEE, 0xEE,
+0xEE, 0xEE, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xCC, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xBB, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x11, 0x11, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0x22, 0x22, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xEE, 0xEE, 0xEE, 0xEE,
+0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0xEE, 0xEE, 0xEE, 0xEE,
+0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xEE, 0xEE,
+0xEE, 0xEE, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22,
+0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x22, 0x22, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE,
+0xEE, 0xEE, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0xEE, 0xEE,
+0xDD, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x55, 0x55, 0xFF, 0xFF, 0xDD, 0xDD, 0xEE, 0xEE, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF, 0xCC, 0xCC, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xFF, 0xFF, 0xDD, 0xDD, 0xFF, 0xFF, 0xCC, 0xCC,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0xFF, 0xFF, 0xBB, 0xBB,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xEE, 0xEE, 0xEE, 0xEE,
+0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0xEE, 0xEE, 0xFF, 0xFF,
+0xDD, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0xFF, 0xFF,
+0xEE, 0xEE, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55,
+0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x66, 0x66, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF,
+0xCC, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xEE, 0xEE,
+0xEE, 0xEE, 0xFF, 0xFF, 0xDD, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x99, 0x99, 0xFF, 0xFF, 0xDD, 0xDD, 0xDD, 0xDD, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x22, 0x22, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0x77, 0x77, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xEE, 0xEE, 0x88, 0x88,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE,
+0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0xFF, 0xFF, 0xEE, 0xEE,
+0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xEE, 0xEE,
+0xEE, 0xEE, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99,
+0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xAA, 0xAA, 0xCC, 0xCC, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF,
+0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xEE, 0xEE,
+0xDD, 0xDD, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xCC, 0xCC, 0xFF, 0xFF, 0xEE, 0xEE, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xFF, 0xFF, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xEE, 0xEE, 0xFF, 0xFF, 0x44, 0x44,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xEE, 0xEE, 0xEE, 0xEE, 0xCC, 0xCC,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0xFF, 0xFF, 0xFF, 0xFF,
+0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC,
+0xFF, 0xFF, 0xFF, 0xFF, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xEE, 0xEE, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x33, 0x33, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0xEE, 0xEE, 0xFF, 0xFF,
+0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x99, 0x99, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0xDD, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0xFF, 0xFF, 0xDD, 0xDD, 0x11, 0x11,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0xFF, 0xFF, 0xEE, 0xEE, 0x99, 0x99,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xEE, 0xEE, 0xEE, 0xEE,
+0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xEE, 0xEE,
+0xEE, 0xEE, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xEE, 0xEE,
+0xEE, 0xEE, 0xFF, 0xFF, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22,
+0xFF, 0xFF, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x22, 0x22, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCC, 0xCC, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xEE, 0xEE, 0xEE, 0xEE,
+0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0xFF, 0xFF, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55,
+0xEE, 0xEE, 0xDD, 0xDD, 0xFF, 0xFF, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xCC, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0xFF, 0xFF, 0xFF, 0xFF, 0x66, 0x66,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0xEE, 0xEE, 0xEE, 0xEE, 0xBB, 0xBB,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0xEE, 0xEE, 0xFF, 0xFF,
+0xCC, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0xFF, 0xFF,
+0xDD, 0xDD, 0xEE, 0xEE, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55,
+0xDD, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xAA, 0xAA, 0x99, 0x99,
+0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xCC, 0xCC, 0xEE, 0xEE, 0xFF, 0xFF, 0x55, 0x55,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xEE, 0xEE, 0xCC, 0xCC,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x33, 0x33, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x11, 0x11, 0xDD, 0xDD, 0xBB, 0xBB, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88,
+0x88, 0x88, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xDD, 0xDD, 0xFF, 0xFF, 0x77, 0x77, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xEE, 0xEE, 0xEE, 0xEE, 0x22, 0x22,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x88,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xEE, 0xEE, 0xFF, 0xFF,
+0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xEE, 0xEE,
+0xEE, 0xEE, 0xDD, 0xDD, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99,
+0xEE, 0xEE, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x88, 0x88, 0x88, 0x88, 0x99, 0x99,
+0x99, 0x99, 0xCC, 0xCC, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xDD, 0xEE, 0xEE, 0xDD, 0xDD, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xFF, 0xFF, 0xEE, 0xEE, 0x99, 0x99,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0xFF, 0xFF, 0x99, 0x99,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xFF, 0xFF, 0xEE, 0xEE,
+0xFF, 0xFF, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC,
+0xEE, 0xEE, 0xEE, 0xEE, 0xCC, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x77, 0x77, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x33, 0x33, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0x33, 0x33, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xEE, 0xEE, 0xFF, 0xFF, 0xCC, 0xCC, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0xFF, 0xFF, 0xEE, 0xEE, 0x44, 0x44,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xEE, 0xEE, 0xDD, 0xDD, 0xFF, 0xFF,
+0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xDD, 0xFF, 0xFF,
+0xEE, 0xEE, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0x88, 0x88,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0xEE, 0xEE, 0x55, 0x55,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xEE, 0xEE,
+0xEE, 0xEE, 0xFF, 0xFF, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xAA, 0xAA, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x77, 0x77, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0xEE, 0xEE, 0xFF, 0xFF, 0x88, 0x88, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xEE, 0xEE, 0xDD, 0xDD, 0x11, 0x11,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0xEE, 0xEE, 0xDD, 0xDD, 0xFF, 0xFF, 0x55, 0x55,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xFF, 0xFF, 0x22, 0x22,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0xFF, 0xFF, 0xDD, 0xDD, 0xEE, 0xEE,
+0xDD, 0xDD, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0xFF, 0xFF,
+0xEE, 0xEE, 0xFF, 0xFF, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xBB, 0xBB, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xEE, 0xEE, 0xDD, 0xDD, 0xCC, 0xCC, 0xDD, 0xDD, 0xFF, 0xFF, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xFF, 0xFF, 0xEE, 0xEE, 0x44, 0x44, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0xDD, 0xDD, 0xEE, 0xEE, 0xBB, 0xBB, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0xFF, 0xFF, 0xFF, 0xFF, 0xCC, 0xCC,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0xEE, 0xEE, 0xDD, 0xDD,
+0xFF, 0xFF, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0x22, 0x22,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xDD, 0xDD, 0xDD, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0xFF, 0xFF, 0xDD, 0xDD, 0xEE, 0xEE,
+0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33,
+0xEE, 0xEE, 0xDD, 0xDD, 0xFF, 0xFF, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x11, 0x11, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0x88, 0x88, 0x00, 0x00, 0x11, 0x11,
+0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xCC, 0xCC, 0xFF, 0xFF, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xDD, 0xFF, 0xFF, 0xDD, 0xDD, 0x11, 0x11, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0xEE, 0xEE, 0xEE, 0xEE, 0x77, 0x77, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xFF, 0xFF, 0xEE, 0xEE, 0x88, 0x88,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xCC, 0xCC, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
+0x88, 0x88, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xCC, 0xCC, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xFF, 0xFF, 0xBB, 0xBB, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xDD, 0xEE, 0xEE, 0xDD, 0xDD, 0xFF, 0xFF,
+0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xFF, 0xFF,
+0xFF, 0xFF, 0xCC, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66,
+0xFF, 0xFF, 0xDD, 0xDD, 0xFF, 0xFF, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x44, 0x44, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xDD, 0xDD, 0xEE, 0xEE, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0xEE, 0xEE, 0xEE, 0xEE, 0x44, 0x44, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0x55, 0x55,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xAA, 0xAA, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0x99, 0x99, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0x88, 0x88, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xEE, 0xEE, 0xFF, 0xFF, 0xDD, 0xDD, 0xEE, 0xEE,
+0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA,
+0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x55, 0x55, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xEE, 0xEE, 0xDD, 0xDD, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0xEE, 0xEE, 0xEE, 0xEE, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xEE, 0xEE, 0xEE, 0xEE, 0x11, 0x11, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0x11, 0x11,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xDD, 0xFF, 0xFF,
+0xEE, 0xEE, 0xFF, 0xFF, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0xDD, 0xDD, 0x77, 0x77, 0x11, 0x11, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xFF, 0xFF, 0x66, 0x66, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0x77, 0x77, 0x33, 0x33, 0xDD, 0xDD,
+0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xDD, 0xDD,
+0xEE, 0xEE, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xDD,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x11, 0x11, 0x88, 0x88, 0xAA, 0xAA, 0xBB, 0xBB, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0xFF, 0xFF, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xEE, 0xEE, 0xEE, 0xEE, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0xDD, 0xDD, 0xFF, 0xFF, 0xCC, 0xCC, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0xFF, 0xFF, 0xEE, 0xEE, 0xBB, 0xBB, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF,
+0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x99, 0x99,
+0xAA, 0xAA, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33,
+0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0xEE, 0xEE, 0xEE, 0xEE, 0x55, 0x55, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0xDD, 0xDD,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0xFF, 0xFF, 0xDD, 0xDD,
+0xEE, 0xEE, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xEE, 0xEE,
+0xEE, 0xEE, 0xFF, 0xFF, 0xBB, 0xBB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xFF, 0xFF, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xEE, 0xEE, 0xEE, 0xEE, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xEE, 0xEE, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xEE, 0xEE, 0xEE, 0xEE, 0x99, 0x99, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF,
+0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0xFF, 0xFF, 0xEE, 0xEE, 0x55, 0x55, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0xCC, 0xCC,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0xFF, 0xFF, 0xDD, 0xDD,
+0xDD, 0xDD, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0xFF, 0xFF,
+0xEE, 0xEE, 0xFF, 0xFF, 0xCC, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x22, 0x22, 0xEE, 0xEE, 0xFF, 0xFF, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xEE, 0xEE, 0xEE, 0xEE, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xEE, 0xEE, 0xEE, 0xEE, 0x88, 0x88, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF,
+0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC,
+0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xAA, 0xAA, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xBB, 0xBB,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0xFF, 0xFF, 0xEE, 0xEE,
+0xEE, 0xEE, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0xFF, 0xFF,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xAA, 0xAA, 0xEE, 0xEE, 0xEE, 0xEE, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCC, 0xCC, 0xEE, 0xEE, 0xEE, 0xEE, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xEE, 0xEE, 0xEE, 0xEE, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xEE, 0xEE, 0xEE, 0xEE, 0x88, 0x88, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xFF, 0xFF, 0xDD, 0xDD, 0xEE, 0xEE,
+0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xCC, 0xCC, 0x55, 0x55, 0x22, 0x22,
+0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xBB, 0xBB, 0x44, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+0x33, 0x33, 0x88, 0x88, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xAA, 0xAA,
+0x33, 0x33, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x55, 0x55, 0xBB, 0xBB, 0xEE, 0xEE, 0xCC, 0xCC,
+0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0xFF, 0xFF, 0xEE, 0xEE,
+0xFF, 0xFF, 0x44, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x33, 0x33, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xDD, 0xDD, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22,
+0x99, 0x99, 0xFF, 0xFF, 0xDD, 0xDD, 0xEE, 0xEE, 0xAA, 0xAA, 0x11, 0x11, 0x22, 0x22, 0x11, 0x11,
+0x11, 0x11, 0x11, 0x11, 0xBB, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0xDD, 0xDD, 0xEE, 0xEE, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x11, 0x11,
+0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x99, 0x99, 0xFF, 0xFF, 0xDD, 0xDD, 0xDD, 0xDD,
+0xFF, 0xFF, 0x88, 0x88, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x55, 0x55, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF,
+0xEE, 0xEE, 0xCC, 0xCC, 0xCC, 0xCC, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xDD, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xCC, 0xCC, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xDD, 0xCC, 0xCC, 0xCC, 0xCC,
+0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xCC, 0xCC, 0xCC, 0xCC, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xDD, 0xCC, 0xCC, 0xCC, 0xCC,
+0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+0xDD, 0xDD, 0xCC, 0xCC, 0xCC, 0xCC, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xDD,
+0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE,
+0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xDD, 0xDD, 0xDD, 0xDD,
+0xDD, 0xDD, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xDD, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF,
+0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xDD, 0xDD, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xDD, 0xDD, 0xEE, 0xEE,
+0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD,
+0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE,
+0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xDD, 0xDD, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00,
+};
@@ -0,0 +1,249 @@
+/* oled_layer.c */
+
+#include <string.h>
+#include "oled_layer.h"
+#include "oled_font.h"
+
+#ifndef SSD1322_NO_FRAMEBUFFER
+
+static ssd1322_layer_t *bg;
+static ssd1322_layer_t *over[SSD1322_LAYER_MAX];
+static int      n_over;
+static uint8_t  content_key = SSD1322_LAYER_OPAQUE;
+
+static inline uint8_t layer_get(const ssd1322_layer_t *l, int x, int y)
+{
+    uint32_t bit = (uint32_t)x * l->bpp;
+    uint8_t b = l->bits[y * l->stride + (bit >> 3)];
+    return (uint8_t)((b >> (8 - l->bpp - (bit & 7))) & ((1u << l->bpp) - 1));
+}
+
+/* Değer -> 0..15 seviye */
+static inline uint8_t level_scale(uint8_t bpp)
+{
+    return bpp == 1 ? 15 : bpp == 2 ? 5 : 1;
+}
+
+/*
+ * Bir katmanın satır payını lv[]'ye boyar (ekran x0..x0+n-1, satır y).
+ * Saydam pikseller alttakini bırakır.
+ */
+static void paint(uint8_t *lv, const ssd1322_layer_t *l, int y, int x0, int n)
+{
+    if (!l->visible) return;
+    int ly = y - l->y;
+    if (ly < 0 || ly >= l->h) return;
+
+    int a = x0 > l->x ? x0 : l->x;
+    int b = x0 + n < l->x + l->w ? x0 + n : l->x + l->w;
+    uint8_t scale = level_scale(l->bpp);
+    for (int x = a; x < b; x++) {
+        uint8_t v = layer_get(l, x - l->x, ly);
+        if (v != l->key) lv[x - x0] = (uint8_t)(v * scale);
+    }
+}
+
+/* Refresh satır dönüşümü: alttan üste boyar, seviye -> GDDRAM byte'ı */
+static void compose_row(uint8_t *out, int y, int x0, int n)
+{
+    uint8_t lv[SSD1322_WIDTH];
+
+    if (bg) {
+        memset(lv, 0, (size_t)n);
+        paint(lv, bg, y, x0, n);
+    }
+    const uint8_t *pix = &framebuf[y][x0];
+    for (int i = 0; i < n; i++) {
+        uint8_t g = pix[i] & 0x03;
+        if (!bg || g != content_key) lv[i] = (uint8_t)(g * 5);
+    }
+    for (int k = 0; k < n_over; k++)
+        paint(lv, over[k], y, x0, n);
+
+    for (int i = 0; i < n; i++) {
+        uint8_t b = (uint8_t)(lv[i] * 0x11);
+        out[i * 2 + 0] = b;
+        out[i * 2 + 1] = b;
+    }
+}
+
+static void update_packer(void)
+{
+    SSD1322_SetRowPacker(bg || n_over ? compose_row : NULL);
+}
+
+/* Katmanın tamamını kirli işaretler (göster / gizle / taşı / çıkar) */
+static void mark_whole(ssd1322_layer_t *l)
+{
+    SSD1322_MarkDirty(l->x, l->y, l->x + l->w - 1, l->y + l->h - 1);
+}
+
+void SSD1322_Layer_Init(ssd1322_layer_t *l, uint8_t *buf, int w, int h, uint8_t bpp)
+{
+    memset(l, 0, sizeof(*l));
+    l->bits = buf;
+    l->w = (uint16_t)w;
+    l->h = (uint16_t)h;
+    l->bpp = bpp;
+    l->stride = (uint16_t)((w * bpp + 7) / 8);
+    l->key = 0;
+    l->visible = true;
+    memset(buf, 0, (size_t)l->stride * (size_t)h);
+    l->dx0 = 1;   // temiz
+    l->dx1 = 0;
+}
+
+bool SSD1322_Layer_Add(ssd1322_layer_t *l)
+{
+    if (n_over == SSD1322_LAYER_MAX) return false;
+    over[n_over++] = l;
+    mark_whole(l);
+    update_packer();
+    return true;
+}
+
+void SSD1322_Layer_SetBackground(ssd1322_layer_t *l)
+{
+    if (bg) mark_whole(bg);
+    bg = l;
+    if (bg) mark_whole(bg);
+    update_packer();
+}
+
+void SSD1322_Layer_Remove(ssd1322_layer_t *l)
+{
+    if (bg == l) {
+        SSD1322_Layer_SetBackground(NULL);
+        return;
+    }
+    for (int k = 0; k < n_over; k++) {
+        if (over[k] != l) continue;
+        memmove(&over[k], &over[k + 1], (size_t)(n_over - k - 1) * sizeof(over[0]));
+        n_over--;
+        mark_whole(l);
+        update_packer();
+        return;
+    }
+}
+
+void SSD1322_Layer_SetContentKey(uint8_t key)
+{
+    content_key = key;
+    if (bg) SSD1322_MarkAllDirty();
+}
+
+void SSD1322_Layer_Move(ssd1322_layer_t *l, int x, int y)
+{
+    if (x == l->x && y == l->y) return;
+    if (l->visible) mark_whole(l);
+    l->x = (int16_t)x;
+    l->y = (int16_t)y;
+    if (l->visible) mark_whole(l);
+}
+
+void SSD1322_Layer_Show(ssd1322_layer_t *l, bool visible)
+{
+    if (l->visible == visible) return;
+    l->visible = visible;
+    mark_whole(l);
+}
+
+void SSD1322_Layer_SetKey(ssd1322_layer_t *l, uint8_t key)
+{
+    l->key = key;
+    SSD1322_Layer_MarkDirty(l, 0, 0, l->w - 1, l->h - 1);
+}
+
+void SSD1322_Layer_MarkDirty(ssd1322_layer_t *l, int x0, int y0, int x1, int y1)
+{
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > l->w - 1) x1 = l->w - 1;
+    if (y1 > l->h - 1) y1 = l->h - 1;
+    if (x0 > x1 || y0 > y1) return;
+
+    if (l->dx0 > l->dx1) {
+        l->dx0 = (int16_t)x0; l->dy0 = (int16_t)y0;
+        l->dx1 = (int16_t)x1; l->dy1 = (int16_t)y1;
+        return;
+    }
+    if (x0 < l->dx0) l->dx0 = (int16_t)x0;
+    if (y0 < l->dy0) l->dy0 = (int16_t)y0;
+    if (x1 > l->dx1) l->dx1 = (int16_t)x1;
+    if (y1 > l->dy1) l->dy1 = (int16_t)y1;
+}
+
+void SSD1322_Layer_SetPixel(ssd1322_layer_t *l, int x, int y, uint8_t v)
+{
+    if (x < 0 || y < 0 || x >= l->w || y >= l->h) return;
+    uint32_t bit = (uint32_t)x * l->bpp;
+    uint8_t shift = (uint8_t)(8 - l->bpp - (bit & 7));
+    uint8_t mask = (uint8_t)(((1u << l->bpp) - 1) << shift);
+    uint8_t *p = &l->bits[y * l->stride + (bit >> 3)];
+    *p = (uint8_t)((*p & ~mask) | ((v << shift) & mask));
+    SSD1322_Layer_MarkDirty(l, x, y, x, y);
+}
+
+uint8_t SSD1322_Layer_GetPixel(const ssd1322_layer_t *l, int x, int y)
+{
+    if (x < 0 || y < 0 || x >= l->w || y >= l->h) return 0;
+    return layer_get(l, x, y);
+}
+
+void SSD1322_Layer_FillRect(ssd1322_layer_t *l, int x, int y, int w, int h, uint8_t v)
+{
+    int x0 = x < 0 ? 0 : x, y0 = y < 0 ? 0 : y;
+    int x1 = x + w > l->w ? l->w : x + w;
+    int y1 = y + h > l->h ? l->h : y + h;
+    if (x0 >= x1 || y0 >= y1) return;
+
+    for (int yy = y0; yy < y1; yy++)
+        for (int xx = x0; xx < x1; xx++)
+            SSD1322_Layer_SetPixel(l, xx, yy, v);
+}
+
+void SSD1322_Layer_Clear(ssd1322_layer_t *l, uint8_t v)
+{
+    uint8_t fill = l->bpp == 1 ? (v & 1 ? 0xFF : 0x00)
+                 : l->bpp == 2 ? (uint8_t)((v & 3) * 0x55)
+                 : (uint8_t)((v & 15) * 0x11);
+    memset(l->bits, fill, (size_t)l->stride * l->h);
+    SSD1322_Layer_MarkDirty(l, 0, 0, l->w - 1, l->h - 1);
+}
+
+void SSD1322_Layer_DrawString(ssd1322_layer_t *l, int x, int y, const char *s, uint8_t v)
+{
+    const ssd1322_font_t *f = SSD1322_GetFont();
+    uint32_t cp;
+
+    for (; (cp = SSD1322_Utf8Next(&s, NULL)) != 0; x += f->advance) {
+        const uint8_t *glyph = SSD1322_FontGlyph(f, cp);
+        if (!glyph) glyph = SSD1322_FontGlyph(f, f->fallback);
+        if (!glyph) continue;
+
+        const uint8_t *col_bits = glyph;
+        for (int col = 0; col < f->w; col++, col_bits += f->col_bytes)
+            for (int row = 0; row < f->h; row++)
+                if ((col_bits[row >> 3] >> (row & 7)) & 1)
+                    SSD1322_Layer_SetPixel(l, x + col, y + row, v);
+    }
+}
+
+static void flush_layer(ssd1322_layer_t *l)
+{
+    if (!l || l->dx0 > l->dx1) return;
+    if (l->visible)
+        SSD1322_MarkDirty(l->x + l->dx0, l->y + l->dy0, l->x + l->dx1, l->y + l->dy1);
+    l->dx0 = 1;
+    l->dx1 = 0;
+}
+
+void SSD1322_Layer_Present(void)
+{
+    flush_layer(bg);
+    for (int k = 0; k < n_over; k++)
+        flush_layer(over[k]);
+    SSD1322_RefreshDirty();
+}
+
+#endif /* SSD1322_NO_FRAMEBUFFER */
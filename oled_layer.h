@@ -0,0 +1,75 @@
+/* oled_layer.h */
+
+#ifndef OLED_LAYER_H
+#define OLED_LAYER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oled_ssd1322.h"
+
+/*
+ * Katman yığını: arka plan, içerik (framebuf) ve üst katmanlar (toast,
+ * imleç...). Birleştirme refresh'in satır dönüşümünde yapılır
+ * (SSD1322_SetRowPacker): birleşik kare hiçbir yerde tutulmaz, imleç
+ * yanıp sönerken alttaki içerik yeniden çizilmez.
+ *
+ * Katmanlar paketli 1 / 2 / 4 bpp'dir (MSB = sol piksel), ekranda x, y
+ * konumundadır. Değer seviyeye ölçeklenir: 1bpp 0/15, 2bpp 0/5/10/15,
+ * 4bpp 0..15 (panelin 16 gri seviyesi). key değerindeki pikseller saydamdır.
+ * İçerik katmanı framebuf'tır (2bpp); SSD1322_Layer_SetContentKey ile
+ * arka planı gösterebilir.
+ *
+ * Her katman kendi kirli dikdörtgenini tutar; SSD1322_Layer_Present
+ * bunları ekran koordinatında çekirdeğin kirli takibine ekler ve
+ * RefreshDirty çağırır. Ayna (oled_mirror) packer'dan geçen çıktıyı görür;
+ * band ve geçiş modülleri sadece framebuf'ı görür.
+ */
+#ifndef SSD1322_NO_FRAMEBUFFER
+
+#ifndef SSD1322_LAYER_MAX
+#define SSD1322_LAYER_MAX 4       // içerik üstündeki katman sayısı
+#endif
+
+#define SSD1322_LAYER_OPAQUE 0xFF   // key yok
+
+/* w x h, bpp bit derinlikli katmanın byte cinsinden boyutu */
+#define SSD1322_LAYER_BYTES(w, h, bpp) ((((w) * (bpp) + 7) / 8) * (h))
+
+typedef struct {
+    uint8_t *bits;
+    int16_t  x, y;                 // ekran konumu
+    uint16_t w, h;
+    uint16_t stride;               // satır başına byte
+    uint8_t  bpp;                  // 1, 2, 4
+    uint8_t  key;                  // saydam değer ya da SSD1322_LAYER_OPAQUE
+    bool     visible;
+    int16_t  dx0, dy0, dx1, dy1;   // kirli dikdörtgen (katman koordinatı), dx0 > dx1 = temiz
+} ssd1322_layer_t;
+
+/* buf SSD1322_LAYER_BYTES(w, h, bpp) byte; temizlenir, key = 0, görünür */
+void SSD1322_Layer_Init(ssd1322_layer_t *l, uint8_t *buf, int w, int h, uint8_t bpp);
+
+/* Yığın: ilk Add içeriğin hemen üstü, sonraki her Add bir üstü. Dolu ise false */
+bool SSD1322_Layer_Add(ssd1322_layer_t *l);
+void SSD1322_Layer_SetBackground(ssd1322_layer_t *l);   // NULL = yok (siyah)
+void SSD1322_Layer_Remove(ssd1322_layer_t *l);
+void SSD1322_Layer_SetContentKey(uint8_t key);           // framebuf saydam değeri
+
+void SSD1322_Layer_Move(ssd1322_layer_t *l, int x, int y);
+void SSD1322_Layer_Show(ssd1322_layer_t *l, bool visible);
+void SSD1322_Layer_SetKey(ssd1322_layer_t *l, uint8_t key);
+
+/* Çizim (katman koordinatı, kırpılır); her biri katmanın kirli alanını büyütür */
+void SSD1322_Layer_Clear(ssd1322_layer_t *l, uint8_t v);
+void SSD1322_Layer_SetPixel(ssd1322_layer_t *l, int x, int y, uint8_t v);
+uint8_t SSD1322_Layer_GetPixel(const ssd1322_layer_t *l, int x, int y);   // dışarıda 0
+void SSD1322_Layer_FillRect(ssd1322_layer_t *l, int x, int y, int w, int h, uint8_t v);
+void SSD1322_Layer_DrawString(ssd1322_layer_t *l, int x, int y, const char *s, uint8_t v);  // aktif font, sadece dolu bitler
+void SSD1322_Layer_MarkDirty(ssd1322_layer_t *l, int x0, int y0, int x1, int y1);
+
+/* Katman kirlerini ekrana taşır ve RefreshDirty */
+void SSD1322_Layer_Present(void);
+
+#endif /* SSD1322_NO_FRAMEBUFFER */
+
+#endif /* OLED_LAYER_H */
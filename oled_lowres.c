@@ -0,0 +1,159 @@
+/* oled_lowres.c */
+
+#include <string.h>
+#include "oled_lowres.h"
+
+uint8_t ssd1322_lowres[SSD1322_LOWRES_ROWS][SSD1322_LOWRES_WIDTH];
+
+static ssd1322_surface_t lowres_surface;
+static bool    active;
+static uint8_t vshift;                       // 2X2: 1, 2X1: 0
+
+/* Kirli satır aralıkları (düşük çözünürlük), x0 > x1 ise temiz */
+static uint8_t dirty_x0[SSD1322_LOWRES_ROWS];
+static uint8_t dirty_x1[SSD1322_LOWRES_ROWS];
+static bool    dirty_any;
+
+static void dirty_reset(void)
+{
+    memset(dirty_x0, 0xFF, sizeof(dirty_x0));
+    memset(dirty_x1, 0x00, sizeof(dirty_x1));
+    dirty_any = false;
+}
+
+/*
+ * Tam çözünürlük kolonları [x0, x0 + n) için lowres satırını paketler:
+ * piksel başına 4 byte (2 kolon x 2 byte), pencere tek kolonda başlayıp
+ * bitebilir.
+ */
+static void pack_span(uint8_t *out, const uint8_t *row, int x0, int n)
+{
+    int x = x0;
+    if ((x & 1) && n) {
+        memset(out, (row[x >> 1] & 0x03) * 0x55, 2);
+        out += 2;
+        x++;
+        n--;
+    }
+    for (; n >= 2; n -= 2, x += 2, out += 4)
+        memset(out, (row[x >> 1] & 0x03) * 0x55, 4);
+    if (n) memset(out, (row[x >> 1] & 0x03) * 0x55, 2);
+}
+
+int SSD1322_Lowres_Height(void)
+{
+    return SSD1322_HEIGHT >> vshift;
+}
+
+bool SSD1322_Lowres_Active(void)
+{
+    return active;
+}
+
+#ifndef SSD1322_NO_FRAMEBUFFER
+static void lowres_row(uint8_t *out, int y, int x0, int n)
+{
+    pack_span(out, ssd1322_lowres[y >> vshift], x0, n);
+}
+#endif
+
+void SSD1322_Lowres_Begin(uint8_t mode)
+{
+    vshift = (mode == SSD1322_LOWRES_2X1 && SSD1322_LOWRES_ROWS >= SSD1322_HEIGHT) ? 0 : 1;
+    SSD1322_SurfaceInit(&lowres_surface, &ssd1322_lowres[0][0],
+                        SSD1322_LOWRES_WIDTH, SSD1322_Lowres_Height(), 0);
+    SSD1322_SetTarget(&lowres_surface);
+#ifndef SSD1322_NO_FRAMEBUFFER
+    SSD1322_SetRowPacker(lowres_row);
+#endif
+    dirty_reset();
+    active = true;
+}
+
+void SSD1322_Lowres_End(void)
+{
+    SSD1322_SetTarget(NULL);
+#ifndef SSD1322_NO_FRAMEBUFFER
+    SSD1322_SetRowPacker(NULL);
+#endif
+    active = false;
+}
+
+void SSD1322_Lowres_MarkDirty(int x0, int y0, int x1, int y1)
+{
+    int h = SSD1322_Lowres_Height();
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > SSD1322_LOWRES_WIDTH - 1) x1 = SSD1322_LOWRES_WIDTH - 1;
+    if (y1 > h - 1) y1 = h - 1;
+    if (x0 > x1 || y0 > y1) return;
+
+    if (!dirty_any) dirty_reset();
+    for (int y = y0; y <= y1; y++) {
+        if (x0 < dirty_x0[y]) dirty_x0[y] = (uint8_t)x0;
+        if (x1 > dirty_x1[y]) dirty_x1[y] = (uint8_t)x1;
+    }
+    dirty_any = true;
+}
+
+/* Düşük çözünürlük penceresini tam çözünürlükte gönderir */
+static void present_window(int x0, int y0, int x1, int y1)
+{
+    int fx0 = x0 * 2, fx1 = x1 * 2 + 1;
+    int fy0 = y0 << vshift, fy1 = ((y1 + 1) << vshift) - 1;
+
+#ifndef SSD1322_NO_FRAMEBUFFER
+    SSD1322_RefreshRegion(fx0, fy0, fx1, fy1);   // lowres_row ile, kayma ve kurtarma dahil
+#else
+    /* panelden taşan kolonlar (yatay kayma) atlanır */
+    int dx = SSD1322_GetShiftX();
+    if (fx0 + dx < 0) fx0 = -dx;
+    if (fx1 + dx > SSD1322_WIDTH - 1) fx1 = SSD1322_WIDTH - 1 - dx;
+    if (fx0 > fx1) return;
+
+    SSD1322_SetColumn((uint8_t)(COLUMN_START + fx0 + dx), (uint8_t)(COLUMN_START + fx1 + dx));
+    SSD1322_SetRow((uint8_t)(ROW_START + fy0), (uint8_t)(ROW_START + fy1));
+    SSD1322_SendCommand(0x5C); // Write RAM
+
+    uint8_t linebuf[SSD1322_WIDTH * 2];
+    uint16_t n = (uint16_t)((fx1 - fx0 + 1) * 2);
+    for (int y = y0; y <= y1 && SSD1322_LinkOk(); y++) {
+        pack_span(linebuf, ssd1322_lowres[y], fx0, fx1 - fx0 + 1);
+        for (int k = 0; k < 1 << vshift; k++) SSD1322_WriteData(linebuf, n);   // dikey çoğaltma
+    }
+    if (!SSD1322_LinkOk()) SSD1322_Lowres_MarkDirty(x0, y0, x1, y1);   // resync'te tekrar
+#endif
+}
+
+void SSD1322_Lowres_Present(void)
+{
+    dirty_reset();
+#ifndef SSD1322_NO_FRAMEBUFFER
+    SSD1322_RefreshFromFramebuffer();
+#else
+    present_window(0, 0, SSD1322_LOWRES_WIDTH - 1, SSD1322_Lowres_Height() - 1);
+#endif
+}
+
+/* Ardışık kirli satırlar tek pencerede (SSD1322_RefreshDirty gibi) */
+void SSD1322_Lowres_PresentDirty(void)
+{
+    if (!dirty_any) return;
+
+    uint8_t sx0[SSD1322_LOWRES_ROWS], sx1[SSD1322_LOWRES_ROWS];
+    int h = SSD1322_Lowres_Height();
+    memcpy(sx0, dirty_x0, sizeof(sx0));
+    memcpy(sx1, dirty_x1, sizeof(sx1));
+    dirty_reset();
+
+    int y = 0;
+    while (y < h) {
+        if (sx0[y] > sx1[y]) { y++; continue; }
+        int y0 = y, x0 = sx0[y], x1 = sx1[y];
+        while (++y < h && sx0[y] <= sx1[y]) {
+            if (sx0[y] < x0) x0 = sx0[y];
+            if (sx1[y] > x1) x1 = sx1[y];
+        }
+        present_window(x0, y0, x1, y - 1);
+    }
+}
@@ -0,0 +1,50 @@
+/* oled_lowres.h */
+
+#ifndef OLED_LOWRES_H
+#define OLED_LOWRES_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oled_ssd1322.h"
+
+/*
+ * Düşük çözünürlük modu: sahne 64 kolonluk ssd1322_lowres tamponuna çizilir,
+ * piksel çoğaltma çıkışta, satırlar gönderilirken yapılır:
+ *   SSD1322_LOWRES_2X2  64x32, yatay ve dikey 2 kat (çizim / RAM 1/4)
+ *   SSD1322_LOWRES_2X1  64x64, sadece yatay 2 kat   (çizim / RAM 1/2)
+ * Düşük çözünürlüklü piksel 4 GDDRAM byte'ı olur, dikeyde aynı satır iki kez
+ * gider (bir kez paketlenir). İri ikon ve büyük rakamlı ekranlar için.
+ *
+ * Begin ile çizim hedefi tampon olur, koordinatlar düşük çözünürlüktedir.
+ * Framebuf'lı derlemede çıkış satır paketleyicisi (SSD1322_SetRowPacker)
+ * olarak bağlanır: Refresh yolları, bağlantı kurtarması ve yatay kayma
+ * (oled_orbit) çoğaltılmış görüntüyü gönderir; oled_layer ile aynı anda
+ * kullanılmaz. SSD1322_NO_FRAMEBUFFER ile pencereler doğrudan gönderilir,
+ * kurtarmada uygulamanın resync callback'i SSD1322_Lowres_Present çağırır.
+ *
+ * Tampon framebuf'tan ayrıdır: mod açıkken framebuf'ı okuyan modüller
+ * (geçiş, yığın, döndürme) eski tam çözünürlüklü kareyi görür, ayna ise
+ * packer'dan geçen düşük çözünürlüklü çıktıyı. Sadece 2X2 kullanılıyorsa
+ * SSD1322_LOWRES_ROWS 32 verilir (2 KB); bu durumda 2X1 isteği 2X2 olur.
+ */
+#define SSD1322_LOWRES_2X2   0
+#define SSD1322_LOWRES_2X1   1
+
+#define SSD1322_LOWRES_WIDTH (SSD1322_WIDTH / 2)
+#ifndef SSD1322_LOWRES_ROWS
+#define SSD1322_LOWRES_ROWS  SSD1322_HEIGHT
+#endif
+
+extern uint8_t ssd1322_lowres[SSD1322_LOWRES_ROWS][SSD1322_LOWRES_WIDTH];
+
+void SSD1322_Lowres_Begin(uint8_t mode);   // hedef + çıkış düşük çözünürlük
+void SSD1322_Lowres_End(void);             // hedef = framebuf, normal çıkış
+bool SSD1322_Lowres_Active(void);
+int  SSD1322_Lowres_Height(void);          // 32 / 64
+
+/* Düşük çözünürlük koordinatında, dahil */
+void SSD1322_Lowres_MarkDirty(int x0, int y0, int x1, int y1);
+void SSD1322_Lowres_Present(void);         // tüm ekran
+void SSD1322_Lowres_PresentDirty(void);    // kirli satırlar pencere pencere
+
+#endif /* OLED_LOWRES_H */
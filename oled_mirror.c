@@ -0,0 +1,148 @@
+/* oled_mirror.c */
+
+#include <string.h>
+#include "oled_mirror.h"
+
+#ifndef SSD1322_NO_FRAMEBUFFER
+
+#define PK_W (SSD1322_WIDTH / 2)      // paketli satır: 64 byte (4 bit seviye)
+
+static ssd1322_mirror_sink_t sink;
+static void    *sink_ctx;
+static uint8_t  shadow[SSD1322_HEIGHT][PK_W];
+static uint8_t  row_valid[SSD1322_HEIGHT];   // gölge satırı alıcıda var mı
+static uint8_t  seq;
+static uint8_t  refresh_y;
+static ssd1322_mirror_stats_t stats;
+
+static uint8_t  out[SSD1322_MIRROR_CHUNK];
+static uint16_t out_n;
+static uint16_t crc;
+
+static void flush(void)
+{
+    if (out_n) sink(out, out_n, sink_ctx);
+    stats.bytes += out_n;
+    out_n = 0;
+}
+
+static void put_raw(uint8_t b)
+{
+    out[out_n++] = b;
+    if (out_n == sizeof(out)) flush();
+}
+
+/* CRC-16/CCITT, bit bit: kare başına birkaç yüz byte */
+static void put(uint8_t b)
+{
+    crc ^= (uint16_t)(b << 8);
+    for (int i = 0; i < 8; i++)
+        crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    put_raw(b);
+}
+
+/* Satırı refresh yolundan alır (katman, lowres packer'ı dahil), piksel başına seviye */
+static void pack_row(uint8_t *dst, int y)
+{
+    uint8_t gd[SSD1322_WIDTH * 2];
+    SSD1322_PackRow(gd, y, 0, SSD1322_WIDTH);
+    for (int i = 0; i < PK_W; i++)
+        dst[i] = (uint8_t)((gd[i * 4] & 0xF0) | (gd[i * 4 + 2] & 0x0F));
+}
+
+/* oled_stack ile aynı PackBits benzeri kodlama */
+static void put_rle(const uint8_t *p, int n)
+{
+    int i = 0;
+    while (i < n) {
+        int run = 1;
+        while (i + run < n && run < 130 && p[i + run] == p[i]) run++;
+        if (run >= 3) {
+            put((uint8_t)(125 + run));
+            put(p[i]);
+            i += run;
+            continue;
+        }
+        int j = i;
+        while (j < n && j - i < 128) {
+            if (j + 2 < n && p[j + 1] == p[j] && p[j + 2] == p[j]) break;
+            j++;
+        }
+        put((uint8_t)(j - i - 1));
+        for (; i < j; i++) put(p[i]);
+    }
+}
+
+static void mirror_present(void *ctx)
+{
+    (void)ctx;
+    uint8_t cur[PK_W];
+
+    put_raw(SSD1322_MIRROR_SYNC0);
+    put_raw(SSD1322_MIRROR_SYNC1);
+    crc = 0xFFFF;
+    put(seq++);
+
+    for (int y = 0; y < SSD1322_HEIGHT; y++) {
+        pack_row(cur, y);
+
+        int x0 = 0, x1 = PK_W - 1;
+        bool refresh = false;
+        for (int k = 0; k < SSD1322_MIRROR_REFRESH_ROWS; k++)
+            if (y == (refresh_y + k) % SSD1322_HEIGHT) refresh = true;
+
+        if (row_valid[y] && !refresh) {
+            while (x0 < PK_W && cur[x0] == shadow[y][x0]) x0++;
+            if (x0 == PK_W) continue;
+            while (cur[x1] == shadow[y][x1]) x1--;
+        }
+
+        put((uint8_t)y);
+        put((uint8_t)x0);
+        put((uint8_t)(x1 - x0 + 1));
+        put_rle(&cur[x0], x1 - x0 + 1);
+        memcpy(&shadow[y][x0], &cur[x0], (size_t)(x1 - x0 + 1));
+        row_valid[y] = 1;
+        stats.rows++;
+    }
+    refresh_y = (uint8_t)((refresh_y + SSD1322_MIRROR_REFRESH_ROWS) % SSD1322_HEIGHT);
+
+    put(SSD1322_MIRROR_END);
+    uint16_t c = crc;
+    put_raw((uint8_t)c);
+    put_raw((uint8_t)(c >> 8));
+    flush();
+    stats.frames++;
+}
+
+void SSD1322_Mirror_Init(ssd1322_mirror_sink_t fn, void *ctx)
+{
+    sink = fn;
+    sink_ctx = ctx;
+    out_n = 0;
+    SSD1322_Mirror_Resync();
+    SSD1322_SetPresentCallback(mirror_present, NULL);
+}
+
+void SSD1322_Mirror_Stop(void)
+{
+    SSD1322_SetPresentCallback(NULL, NULL);
+    sink = NULL;
+}
+
+void SSD1322_Mirror_Present(void)
+{
+    if (sink) mirror_present(NULL);
+}
+
+void SSD1322_Mirror_Resync(void)
+{
+    memset(row_valid, 0, sizeof(row_valid));
+}
+
+void SSD1322_Mirror_GetStats(ssd1322_mirror_stats_t *o)
+{
+    *o = stats;
+}
+
+#endif /* SSD1322_NO_FRAMEBUFFER */
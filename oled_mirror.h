@@ -0,0 +1,75 @@
+/* oled_mirror.h */
+
+#ifndef OLED_MIRROR_H
+#define OLED_MIRROR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oled_ssd1322.h"
+
+/*
+ * Panel aynası: her present'te (RefreshFromFramebuffer / RefreshDirty)
+ * son gönderilen kareye göre değişen satır aralıkları bir byte sink'e
+ * (UART, USB CDC, Linux'ta pipe / pty) yazılır. tools/ssd1322_mirror.c
+ * akıştan kareleri geri kurar. Satırlar RefreshFromFramebuffer ile aynı
+ * yoldan (SSD1322_PackRow: aktif katman / lowres packer'ı dahil) 4 bit
+ * seviye olarak alınır; ayna framebuf'ı değil panele gideni gösterir.
+ *
+ * Ayna 4 bit paketli bir gölge kare tutar (64 x 64 byte); değişmeyen satır
+ * gönderilmez. Her karede ayrıca SSD1322_MIRROR_REFRESH_ROWS satır sırayla
+ * koşulsuz gönderilir: sonradan bağlanan ya da kare kaçıran alıcı en fazla
+ * 64 / SSD1322_MIRROR_REFRESH_ROWS karede toparlanır.
+ *
+ * Kareler sadece present'te gider; SSD1322_RefreshDirty kirli bölge yoksa
+ * present callback'ini çağırmaz. Ekran durağansa tazeleme de durur, alıcı
+ * toparlanamaz: uygulama SSD1322_Mirror_Present'i periyodik çağırmalıdır
+ * (ör. 100 ms'de bir; değişiklik yoksa kare sadece tazeleme satırını taşır).
+ *
+ * Kare formatı:
+ *   0xA5 0x5A seq
+ *   satır kaydı*:  y (0..63)  x0  n  RLE(n paketli byte)
+ *   0xFF  crc16 (LE, CCITT 0x1021 / 0xFFFF, seq'ten 0xFF dahil)
+ * x0 / n paketli byte cinsindendir (1 byte = 2 piksel, üst nibble = sol piksel).
+ * RLE: 0x00..0x7F n+1 literal byte, 0x80..0xFF sıradaki byte n-125 kez.
+ *
+ * Sink kare boyunca SSD1322_MIRROR_CHUNK byte'lık parçalarla çağrılır,
+ * dönüşte tamponu tekrar kullanılabilir bırakmalıdır (kopyalamalı ya da
+ * göndermeyi bitirmeli).
+ */
+#ifndef SSD1322_NO_FRAMEBUFFER
+
+#ifndef SSD1322_MIRROR_CHUNK
+#define SSD1322_MIRROR_CHUNK 128u
+#endif
+
+#ifndef SSD1322_MIRROR_REFRESH_ROWS
+#define SSD1322_MIRROR_REFRESH_ROWS 1
+#endif
+
+#define SSD1322_MIRROR_SYNC0   0xA5
+#define SSD1322_MIRROR_SYNC1   0x5A
+#define SSD1322_MIRROR_END     0xFF
+
+typedef void (*ssd1322_mirror_sink_t)(const uint8_t *data, uint16_t len, void *ctx);
+
+typedef struct {
+    uint32_t frames;
+    uint32_t rows;            // gönderilen satır kaydı (tazeleme dahil)
+    uint32_t bytes;           // sink'e yazılan toplam
+} ssd1322_mirror_stats_t;
+
+/* Present callback'ini kaydeder, sonraki kare tam gönderilir */
+void SSD1322_Mirror_Init(ssd1322_mirror_sink_t sink, void *ctx);
+void SSD1322_Mirror_Stop(void);
+
+/* Bekleyen değişiklikleri hemen gönderir (present dışında); durağan ekranda periyodik çağrılır */
+void SSD1322_Mirror_Present(void);
+
+/* Gölgeyi geçersiz kılar: sonraki kare tüm satırları içerir */
+void SSD1322_Mirror_Resync(void);
+
+void SSD1322_Mirror_GetStats(ssd1322_mirror_stats_t *out);
+
+#endif /* SSD1322_NO_FRAMEBUFFER */
+
+#endif /* OLED_MIRROR_H */
@@ -0,0 +1,130 @@
+/* oled_orbit.c */
+
+#include "oled_orbit.h"
+
+static bool     active;
+static uint8_t  orb_rx, orb_ry;
+static uint32_t orb_period, orb_last;
+static bool     orb_started;
+static int      orb_step, orb_steps;     // ileri-geri sayaç, 0..orb_steps-1
+static int      cur_dx, cur_dy;
+static int      blank_base = -1;         // kenar satırları yazılmış görünür sayfa
+static uint32_t blank_reinits;
+
+/* k. adımın konumu: sütun sütun yılan, N konumdan sonra geri */
+static void pos_of(int k, int *dx, int *dy)
+{
+    int ny = 2 * orb_ry + 1, n = (2 * orb_rx + 1) * ny;
+    int p = k < n ? k : 2 * n - 2 - k;
+    int c = p / ny, i = p % ny;
+    if (c & 1) i = ny - 1 - i;
+    *dx = c - orb_rx;
+    *dy = i - orb_ry;
+}
+
+/* Kaymada açılan kenar kolonlarını görünür sayfada siyaha yazar */
+static void blank_edge(int dx)
+{
+    static const uint8_t zero[SSD1322_ORBIT_MAX * 2];
+    int n = dx < 0 ? -dx : dx, x0 = dx > 0 ? 0 : SSD1322_WIDTH - n;
+
+    if (!n) return;
+    SSD1322_SetColumn((uint8_t)(COLUMN_START + x0), (uint8_t)(COLUMN_START + x0 + n - 1));
+    SSD1322_SetRow(ROW_START, ROW_END);
+    SSD1322_SendCommand(0x5C); // Write RAM
+    for (int i = 0; i < SSD1322_HEIGHT; i++) SSD1322_WriteData(zero, (uint16_t)(n * 2));
+}
+
+static void apply(int dx, int dy)
+{
+    /* offset d: ekranın 0. satırı start + d'yi gösterir, görüntü d yukarı */
+    if (dy != cur_dy) SSD1322_SetDisplayOffset((uint8_t)(-dy & 0x7F));
+    if (dx != cur_dx) {
+        /* içerik yeniden yazılmalı: framebuf ya da akışın sahibi (band, anim) */
+        SSD1322_SetShiftX(dx);
+        blank_edge(dx);
+        SSD1322_Resync();
+    }
+    cur_dx = dx;
+    cur_dy = dy;
+}
+
+/* Görünmeyen sayfanın ilk ve son ry satırını siyaha yazar */
+static void blank_margins(void)
+{
+    static const uint8_t zero[SSD1322_WIDTH * 2];
+    const int H = SSD1322_HEIGHT, r = orb_ry;
+
+    if (!r) return;
+    SSD1322_SetColumn(COLUMN_START, COLUMN_END);
+    SSD1322_SetRow((uint8_t)(ROW_START + H), (uint8_t)(ROW_START + H + r - 1));
+    SSD1322_SendCommand(0x5C); // Write RAM
+    for (int i = 0; i < r; i++) SSD1322_WriteData(zero, sizeof(zero));
+
+    SSD1322_SetRow((uint8_t)(ROW_START + 2 * H - r), (uint8_t)(ROW_START + 2 * H - 1));
+    SSD1322_SendCommand(0x5C);
+    for (int i = 0; i < r; i++) SSD1322_WriteData(zero, sizeof(zero));
+}
+
+void SSD1322_Orbit_Start(uint8_t rx, uint8_t ry, uint32_t period_ms)
+{
+    if (active) SSD1322_Orbit_Stop();
+
+    orb_rx = rx > SSD1322_ORBIT_MAX ? SSD1322_ORBIT_MAX : rx;
+    orb_ry = ry > SSD1322_ORBIT_MAX ? SSD1322_ORBIT_MAX : ry;
+    orb_period = period_ms ? period_ms : 1;
+    orb_started = false;
+
+    int n = (2 * orb_rx + 1) * (2 * orb_ry + 1);
+    orb_steps = n > 1 ? 2 * n - 2 : 0;
+    orb_step = orb_rx * (2 * orb_ry + 1) + orb_ry;   // (0, 0)'dan başla
+    cur_dx = cur_dy = 0;
+    blank_base = -1;
+    active = true;
+}
+
+void SSD1322_Orbit_Stop(void)
+{
+    if (!active) return;
+    apply(0, 0);
+    active = false;
+}
+
+bool SSD1322_Orbit_Tick(uint32_t now_ms)
+{
+    if (!active || !SSD1322_LinkOk()) return false;
+
+    /* sayfa çevrildi ya da panel yeniden init edildi: kenarlar tekrar */
+    ssd1322_link_stats_t st;
+    SSD1322_GetLinkStats(&st);
+    if (SSD1322_GetRowBase() != blank_base || st.reinits != blank_reinits) {
+        blank_margins();
+        blank_base = SSD1322_GetRowBase();
+        blank_reinits = st.reinits;
+    }
+
+    if (!orb_started) {
+        orb_started = true;
+        orb_last = now_ms;
+        return false;
+    }
+    if (!orb_steps || (uint32_t)(now_ms - orb_last) < orb_period) return false;
+    orb_last = now_ms;
+
+    int dx, dy;
+    orb_step = (orb_step + 1) % orb_steps;
+    pos_of(orb_step, &dx, &dy);
+    apply(dx, dy);
+    return true;
+}
+
+bool SSD1322_Orbit_Active(void)
+{
+    return active;
+}
+
+void SSD1322_Orbit_GetShift(int *dx, int *dy)
+{
+    if (dx) *dx = cur_dx;
+    if (dy) *dy = cur_dy;
+}
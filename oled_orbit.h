@@ -0,0 +1,44 @@
+/* oled_orbit.h */
+
+#ifndef OLED_ORBIT_H
+#define OLED_ORBIT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oled_ssd1322.h"
+
+/*
+ * Yanma (burn-in) önleme: görüntü period_ms'de bir, (-rx..rx, -ry..ry)
+ * ızgarasında tek piksel kayar.
+ *
+ * Dikey kayma display offset (0xA2) ile yapılır: adım başına 2 byte komut,
+ * GDDRAM ve framebuf'a dokunulmaz. Start line (0xA1) ile birleşir, sayfa
+ * çevirme ve PUSH geçişleri aynen çalışır. Kaymada görünen komşu satırlar
+ * görünmeyen sayfanın ilk / son ry satırıdır; bunlar siyah tutulur (görünür
+ * sayfa değişince ve kurtarma init'inden sonra Tick tekrar yazar).
+ *
+ * SSD1322'de yatay kaydırma register'ı yoktur: yatay kayma kolon
+ * pencerelerine eklenir (SSD1322_SetShiftX; refresh, band, wire 0x15),
+ * adımında açılan kenar siyaha yazılır ve SSD1322_Resync çağrılır. Resync
+ * callback'i yoksa framebuf'tan tam refresh gider; band / anim gibi
+ * GDDRAM'a doğrudan yazan modüller varken callback kaydedilmeli ve içeriği
+ * onlar yeniden yazmalı (Band_Render, SSD1322_Anim_Resync). Yol yılan
+ * gibidir: bir kolondaki tüm dikey konumlar gezilip sonra yana geçilir,
+ * uçlarda geri döner; yatay adım 2ry+1 adımda bir olur.
+ *
+ * Çizim ve kirli bölgeler framebuf koordinatında kalır, refresh yolları
+ * kaymayı kendisi uygular. Kenarlardan rx / ry piksel taşar; kalıcı içerik
+ * bu pay içinde tutulmalı. SSD1322_NO_FRAMEBUFFER'da rx > 0 için resync
+ * callback'i şarttır (framebuf yok, yeniden yazacak başka kimse yok).
+ */
+#define SSD1322_ORBIT_MAX 4     // rx, ry üst sınırı
+
+void SSD1322_Orbit_Start(uint8_t rx, uint8_t ry, uint32_t period_ms);
+void SSD1322_Orbit_Stop(void);                  // kaymayı sıfırlar
+
+/* SSD1322_Orbit_Tick(HAL_GetTick()) ana döngüden; konum değiştiyse true */
+bool SSD1322_Orbit_Tick(uint32_t now_ms);
+bool SSD1322_Orbit_Active(void);
+void SSD1322_Orbit_GetShift(int *dx, int *dy);  // aşağı / sağa pozitif
+
+#endif /* OLED_ORBIT_H */
@@ -0,0 +1,419 @@
+/* oled_qr.c */
+
+#include <string.h>
+#include "oled_qr.h"
+
+#define RAW_CW_MAX  346     // sürüm 10 toplam kod kelimesi
+#define ECC_CW_MAX  30      // blok başına en fazla ECC
+
+/* Blok başına ECC kod kelimesi ve blok sayısı [ecc][sürüm] */
+static const uint8_t ecc_per_block[4][SSD1322_QR_VERSION_MAX + 1] = {
+    { 0,  7, 10, 15, 20, 26, 18, 20, 24, 30, 18 },   // L
+    { 0, 10, 16, 26, 18, 24, 16, 18, 22, 22, 26 },   // M
+    { 0, 13, 22, 18, 26, 18, 24, 18, 22, 20, 24 },   // Q
+    { 0, 17, 28, 22, 16, 22, 28, 26, 26, 24, 28 },   // H
+};
+static const uint8_t num_blocks[4][SSD1322_QR_VERSION_MAX + 1] = {
+    { 0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 4 },
+    { 0, 1, 1, 1, 2, 2, 4, 4, 4, 5, 5 },
+    { 0, 1, 1, 2, 2, 4, 4, 6, 6, 8, 8 },
+    { 0, 1, 1, 2, 4, 4, 4, 5, 6, 8, 8 },
+};
+static const uint8_t ecc_format_bits[4] = { 1, 0, 3, 2 };
+
+/* Statik arena */
+static struct {
+    uint64_t mod[SSD1322_QR_SIZE_MAX];    // bit x: modül (x, y), 1 = koyu
+    uint64_t func[SSD1322_QR_SIZE_MAX];   // fonksiyon desenleri (maske uygulanmaz)
+    uint8_t  cw[RAW_CW_MAX];              // veri blokları, ardından ECC blokları
+    uint8_t  out[RAW_CW_MAX];             // araya serpiştirilmiş sıra
+    uint8_t  gen[ECC_CW_MAX];             // Reed-Solomon bölen
+    uint8_t  version, size, ecc;
+} qr;
+
+/* ---------- tablolar ---------- */
+
+static int raw_codewords(int ver)
+{
+    int r = (16 * ver + 128) * ver + 64;
+    if (ver >= 2) {
+        int n = ver / 7 + 2;
+        r -= (25 * n - 10) * n - 55;
+        if (ver >= 7) r -= 36;
+    }
+    return r / 8;
+}
+
+static int data_codewords(int ver, int ecc)
+{
+    return raw_codewords(ver) - ecc_per_block[ecc][ver] * num_blocks[ecc][ver];
+}
+
+static int align_positions(int ver, uint8_t *pos)
+{
+    if (ver == 1) return 0;
+    int n = ver / 7 + 2;
+    int step = (ver * 8 + n * 3 + 5) / (n * 4 - 4) * 2;
+    pos[0] = 6;
+    for (int i = n - 1, p = 17 + 4 * ver - 7; i >= 1; i--, p -= step)
+        pos[i] = (uint8_t)p;
+    return n;
+}
+
+/* ---------- Reed-Solomon, GF(2^8) / 0x11D ---------- */
+
+static uint8_t gf_mul(uint8_t x, uint8_t y)
+{
+    uint8_t z = 0;
+    for (int i = 7; i >= 0; i--) {
+        z = (uint8_t)((z << 1) ^ ((z >> 7) * 0x1D));
+        if ((y >> i) & 1) z ^= x;
+    }
+    return z;
+}
+
+static void rs_divisor(int degree)
+{
+    memset(qr.gen, 0, (size_t)degree);
+    qr.gen[degree - 1] = 1;
+    uint8_t root = 1;
+    for (int i = 0; i < degree; i++) {
+        for (int j = 0; j < degree; j++) {
+            qr.gen[j] = gf_mul(qr.gen[j], root);
+            if (j + 1 < degree) qr.gen[j] ^= qr.gen[j + 1];
+        }
+        root = gf_mul(root, 0x02);
+    }
+}
+
+static void rs_remainder(const uint8_t *data, int len, uint8_t *rem, int degree)
+{
+    memset(rem, 0, (size_t)degree);
+    for (int i = 0; i < len; i++) {
+        uint8_t factor = data[i] ^ rem[0];
+        memmove(rem, rem + 1, (size_t)(degree - 1));
+        rem[degree - 1] = 0;
+        for (int j = 0; j < degree; j++)
+            rem[j] ^= gf_mul(qr.gen[j], factor);
+    }
+}
+
+/* ---------- modül matrisi ---------- */
+
+static inline bool module_at(int x, int y)
+{
+    return (qr.mod[y] >> x) & 1u;
+}
+
+static void set_func(int x, int y, bool dark)
+{
+    uint64_t b = 1ull << x;
+    if (dark) qr.mod[y] |= b;
+    else      qr.mod[y] &= ~b;
+    qr.func[y] |= b;
+}
+
+static void draw_format(int mask)
+{
+    int data = ecc_format_bits[qr.ecc] << 3 | mask;
+    int rem = data;
+    for (int i = 0; i < 10; i++)
+        rem = (rem << 1) ^ ((rem >> 9) * 0x537);
+    int bits = (data << 10 | rem) ^ 0x5412;
+    int n = qr.size;
+
+    for (int i = 0; i <= 5; i++) set_func(8, i, (bits >> i) & 1);
+    set_func(8, 7, (bits >> 6) & 1);
+    set_func(8, 8, (bits >> 7) & 1);
+    set_func(7, 8, (bits >> 8) & 1);
+    for (int i = 9; i < 15; i++) set_func(14 - i, 8, (bits >> i) & 1);
+
+    for (int i = 0; i < 8; i++)  set_func(n - 1 - i, 8, (bits >> i) & 1);
+    for (int i = 8; i < 15; i++) set_func(8, n - 15 + i, (bits >> i) & 1);
+    set_func(8, n - 8, true);   // her zaman koyu
+}
+
+static void draw_finder(int cx, int cy)
+{
+    for (int dy = -4; dy <= 4; dy++) {
+        for (int dx = -4; dx <= 4; dx++) {
+            int x = cx + dx, y = cy + dy;
+            if (x < 0 || y < 0 || x >= qr.size || y >= qr.size) continue;
+            int adx = dx < 0 ? -dx : dx, ady = dy < 0 ? -dy : dy;
+            int d = adx > ady ? adx : ady;
+            set_func(x, y, d != 2 && d != 4);
+        }
+    }
+}
+
+static void draw_function_patterns(void)
+{
+    int n = qr.size;
+
+    for (int i = 0; i < n; i++) {
+        set_func(6, i, i % 2 == 0);
+        set_func(i, 6, i % 2 == 0);
+    }
+    draw_finder(3, 3);
+    draw_finder(n - 4, 3);
+    draw_finder(3, n - 4);
+
+    uint8_t pos[4];
+    int na = align_positions(qr.version, pos);
+    for (int i = 0; i < na; i++) {
+        for (int j = 0; j < na; j++) {
+            if ((i == 0 && j == 0) || (i == 0 && j == na - 1) || (i == na - 1 && j == 0))
+                continue;
+            for (int dy = -2; dy <= 2; dy++)
+                for (int dx = -2; dx <= 2; dx++) {
+                    int adx = dx < 0 ? -dx : dx, ady = dy < 0 ? -dy : dy;
+                    set_func(pos[i] + dx, pos[j] + dy, (adx > ady ? adx : ady) != 1);
+                }
+        }
+    }
+
+    draw_format(0);   // yer ayırır, maske seçilince yeniden yazılır
+
+    if (qr.version >= 7) {
+        int rem = qr.version;
+        for (int i = 0; i < 12; i++)
+            rem = (rem << 1) ^ ((rem >> 11) * 0x1F25);
+        long bits = (long)qr.version << 12 | rem;
+        for (int i = 0; i < 18; i++) {
+            bool bit = (bits >> i) & 1;
+            int a = n - 11 + i % 3, b = i / 3;
+            set_func(a, b, bit);
+            set_func(b, a, bit);
+        }
+    }
+}
+
+/* Kod kelimelerini sağ alttan zikzak yerleştirir */
+static void draw_codewords(int count)
+{
+    int n = qr.size, i = 0;
+    for (int right = n - 1; right >= 1; right -= 2) {
+        if (right == 6) right = 5;   // dikey timing kolonu
+        for (int vert = 0; vert < n; vert++) {
+            for (int j = 0; j < 2; j++) {
+                int x = right - j;
+                bool upward = ((right + 1) & 2) == 0;
+                int y = upward ? n - 1 - vert : vert;
+                if ((qr.func[y] >> x) & 1u) continue;
+                if (i < count * 8 && ((qr.out[i >> 3] >> (7 - (i & 7))) & 1))
+                    qr.mod[y] |= 1ull << x;
+                i++;
+            }
+        }
+    }
+}
+
+static bool mask_bit(int m, int x, int y)
+{
+    switch (m) {
+        case 0:  return (x + y) % 2 == 0;
+        case 1:  return y % 2 == 0;
+        case 2:  return x % 3 == 0;
+        case 3:  return (x + y) % 3 == 0;
+        case 4:  return (x / 3 + y / 2) % 2 == 0;
+        case 5:  return x * y % 2 + x * y % 3 == 0;
+        case 6:  return (x * y % 2 + x * y % 3) % 2 == 0;
+        default: return ((x + y) % 2 + x * y % 3) % 2 == 0;
+    }
+}
+
+static void apply_mask(int m)
+{
+    for (int y = 0; y < qr.size; y++) {
+        uint64_t bits = 0;
+        for (int x = 0; x < qr.size; x++)
+            if (mask_bit(m, x, y)) bits |= 1ull << x;
+        qr.mod[y] ^= bits & ~qr.func[y];
+    }
+}
+
+/* Tek satır / kolon: uzun koşular (N1) ve bulucu benzeri desen (N3) */
+static long line_penalty(const uint8_t *l, int n)
+{
+    long p = 0;
+    int run = 1;
+    for (int i = 1; i <= n; i++) {
+        if (i < n && l[i] == l[i - 1]) { run++; continue; }
+        if (run >= 5) p += 3 + (run - 5);
+        run = 1;
+    }
+
+    /* 1:1:3:1:1 + 4 açık (kod dışı açık sayılır) */
+    static const uint8_t finder[7] = { 1, 0, 1, 1, 1, 0, 1 };
+    for (int i = 0; i + 7 <= n; i++) {
+        if (memcmp(&l[i], finder, 7)) continue;
+        bool before = true, after = true;
+        for (int k = 1; k <= 4; k++) {
+            if (i - k >= 0 && l[i - k]) before = false;
+            if (i + 6 + k < n && l[i + 6 + k]) after = false;
+        }
+        if (before) p += 40;
+        if (after)  p += 40;
+    }
+    return p;
+}
+
+static long penalty(void)
+{
+    int n = qr.size;
+    uint8_t line[SSD1322_QR_SIZE_MAX];
+    long p = 0;
+    int dark = 0;
+
+    for (int y = 0; y < n; y++) {
+        for (int x = 0; x < n; x++) {
+            line[x] = module_at(x, y);
+            dark += line[x];
+        }
+        p += line_penalty(line, n);
+    }
+    for (int x = 0; x < n; x++) {
+        for (int y = 0; y < n; y++) line[y] = module_at(x, y);
+        p += line_penalty(line, n);
+    }
+
+    /* 2x2 aynı renk (N2) */
+    for (int y = 0; y < n - 1; y++) {
+        uint64_t a = qr.mod[y], b = qr.mod[y + 1];
+        uint64_t same = ~(a ^ b) & ~(a ^ (a >> 1)) & ~(b ^ (b >> 1));
+        same &= (1ull << (n - 1)) - 1;
+        p += 3 * __builtin_popcountll(same);
+    }
+
+    /* koyu oranı (N4): %50'den her %5 sapma 10 puan */
+    int total = n * n;
+    int k = ((dark * 20 - total * 10 < 0 ? total * 10 - dark * 20 : dark * 20 - total * 10) + total - 1) / total - 1;
+    if (k > 0) p += 10L * k;
+    return p;
+}
+
+/* ---------- API ---------- */
+
+bool SSD1322_QR_Encode(const void *data, size_t len, uint8_t ecc, uint8_t min_version)
+{
+    const uint8_t *src = data;
+    int ver;
+
+    qr.version = 0;
+    if (ecc > SSD1322_QR_ECC_H) ecc = SSD1322_QR_ECC_H;
+    if (min_version < 1) min_version = 1;
+
+    long need = 0;
+    for (ver = min_version; ver <= SSD1322_QR_VERSION_MAX; ver++) {
+        need = 4 + (ver < 10 ? 8 : 16) + 8L * (long)len;
+        if (need <= data_codewords(ver, ecc) * 8) break;
+    }
+    if (ver > SSD1322_QR_VERSION_MAX) return false;
+    while (ecc < SSD1322_QR_ECC_H && need <= data_codewords(ver, ecc + 1) * 8)
+        ecc++;
+
+    /* veri kod kelimeleri: mod 0100, uzunluk, byte'lar, sonlandırıcı, dolgu */
+    int cap = data_codewords(ver, ecc);
+    int bit = 0;
+    memset(qr.cw, 0, sizeof(qr.cw));
+#define PUT_BITS(v, n) \
+    for (int b_ = (n) - 1; b_ >= 0; b_--, bit++) \
+        if (((v) >> b_) & 1) qr.cw[bit >> 3] |= (uint8_t)(0x80 >> (bit & 7))
+    PUT_BITS(0x4, 4);
+    PUT_BITS((unsigned)len, ver < 10 ? 8 : 16);
+    for (size_t i = 0; i < len; i++) PUT_BITS(src[i], 8);
+#undef PUT_BITS
+    bit += (cap * 8 - bit < 4) ? cap * 8 - bit : 4;
+    int nd = (bit + 7) / 8;
+    for (uint8_t pad = 0xEC; nd < cap; pad ^= 0xEC ^ 0x11) qr.cw[nd++] = pad;
+
+    /* bloklara ECC ekle, sonra araya serpiştir */
+    int raw = raw_codewords(ver);
+    int nb = num_blocks[ecc][ver], el = ecc_per_block[ecc][ver];
+    int n_short = nb - raw % nb;
+    int short_data = raw / nb - el;
+
+    rs_divisor(el);
+    for (int j = 0, at = 0; j < nb; j++) {
+        int dl = short_data + (j >= n_short);
+        rs_remainder(&qr.cw[at], dl, &qr.cw[cap + j * el], el);
+        at += dl;
+    }
+    int k = 0;
+    for (int i = 0; i <= short_data; i++)
+        for (int j = 0; j < nb; j++) {
+            if (i == short_data && j < n_short) continue;
+            int start = j * short_data + (j > n_short ? j - n_short : 0);
+            qr.out[k++] = qr.cw[start + i];
+        }
+    for (int i = 0; i < el; i++)
+        for (int j = 0; j < nb; j++)
+            qr.out[k++] = qr.cw[cap + j * el + i];
+
+    /* matris */
+    qr.version = (uint8_t)ver;
+    qr.size = (uint8_t)(17 + 4 * ver);
+    qr.ecc = ecc;
+    memset(qr.mod, 0, sizeof(qr.mod));
+    memset(qr.func, 0, sizeof(qr.func));
+    draw_function_patterns();
+    draw_codewords(raw);
+
+    int best = 0;
+    long best_p = -1;
+    for (int m = 0; m < 8; m++) {
+        apply_mask(m);
+        draw_format(m);
+        long p = penalty();
+        if (best_p < 0 || p < best_p) { best_p = p; best = m; }
+        apply_mask(m);   // geri al (XOR)
+    }
+    apply_mask(best);
+    draw_format(best);
+    return true;
+}
+
+int SSD1322_QR_Version(void)
+{
+    return qr.version;
+}
+
+int SSD1322_QR_Size(void)
+{
+    return qr.version ? qr.size : 0;
+}
+
+bool SSD1322_QR_Module(int x, int y)
+{
+    if (!qr.version || x < 0 || y < 0 || x >= qr.size || y >= qr.size) return false;
+    return module_at(x, y);
+}
+
+int SSD1322_QR_Draw(int x, int y, int w, int h, int quiet)
+{
+    if (!qr.version) return 0;
+
+    int n = qr.size, side = w < h ? w : h, scale = 0;
+    for (; quiet >= 0; quiet--)
+        if ((scale = side / (n + 2 * quiet)) >= 1) break;
+    if (scale < 1) return 0;
+
+    int px = scale * (n + 2 * quiet);
+    int ox = x + (w - px) / 2 + quiet * scale;
+    int oy = y + (h - px) / 2 + quiet * scale;
+    SSD1322_FillRect(ox - quiet * scale, oy - quiet * scale, px, px, SSD1322_QR_LIGHT);
+
+    /* koyu modül koşuları tek span */
+    for (int my = 0; my < n; my++) {
+        uint64_t row = qr.mod[my];
+        int mx = 0;
+        while (row >> mx) {
+            while (!((row >> mx) & 1u)) mx++;
+            int run = 0;
+            while (mx + run < n && ((row >> (mx + run)) & 1u)) run++;
+            SSD1322_FillRect(ox + mx * scale, oy + my * scale, run * scale, scale, 0);
+            mx += run;
+        }
+    }
+    return scale;
+}
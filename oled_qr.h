@@ -0,0 +1,54 @@
+/* oled_qr.h */
+
+#ifndef OLED_QR_H
+#define OLED_QR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "oled_ssd1322.h"
+
+/*
+ * QR kod üreteci, sürüm 1..10 (21..57 modül), byte modu.
+ * Heap yok: modül matrisi (satır başına bir uint64_t), fonksiyon deseni
+ * maskesi ve kod kelimeleri sabit bir statik arena'dadır (~1.6 KB).
+ * Sekiz maskenin hepsi denenir, ceza puanı en düşük olan seçilir.
+ *
+ * Çizim modülleri aktif hedefe ölçekli yatay span'ler olarak doldurur
+ * (SSD1322_FillRect); koyu modül 0, açık modül ve sessiz bölge
+ * SSD1322_QR_LIGHT gri. Refresh çağıran tarafındadır.
+ */
+
+#define SSD1322_QR_VERSION_MAX 10
+#define SSD1322_QR_SIZE_MAX    (17 + 4 * SSD1322_QR_VERSION_MAX)
+
+#ifndef SSD1322_QR_LIGHT
+#define SSD1322_QR_LIGHT 3
+#endif
+
+enum {
+    SSD1322_QR_ECC_L,     // ~%7
+    SSD1322_QR_ECC_M,     // ~%15
+    SSD1322_QR_ECC_Q,     // ~%25
+    SSD1322_QR_ECC_H,     // ~%30
+};
+
+/*
+ * len byte'ı en küçük uygun sürüme (>= min_version) kodlar. Sürüm
+ * değişmeden sığıyorsa hata düzeltme seviyesi yükseltilir.
+ * Sığmazsa false, arena boşalır.
+ */
+bool SSD1322_QR_Encode(const void *data, size_t len, uint8_t ecc, uint8_t min_version);
+
+int  SSD1322_QR_Version(void);     // 0 = kod yok
+int  SSD1322_QR_Size(void);        // kenar modül sayısı
+bool SSD1322_QR_Module(int x, int y);
+
+/*
+ * x, y, w, h kutusuna ortalar. Ölçek = en büyük tamsayı ki kod + iki yanda
+ * quiet modül sığsın; sığmazsa sessiz bölge daraltılır, yine sığmazsa
+ * çizmez ve 0 döner. Dönüş: kullanılan ölçek.
+ */
+int  SSD1322_QR_Draw(int x, int y, int w, int h, int quiet);
+
+#endif /* OLED_QR_H */
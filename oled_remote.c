@@ -0,0 +1,117 @@
+/* oled_remote.c - M7 (üretici) tarafı */
+
+#include <string.h>
+#include "oled_remote.h"
+
+#ifndef SSD1322_REMOTE_RING_ADDR
+#ifndef SSD1322_SHARED_RAM
+#define SSD1322_SHARED_RAM
+#endif
+SSD1322_SHARED_RAM ssd1322_ring_t ssd1322_remote_ring;
+#endif
+
+/* x,y koordinat çifti payload başında int16 olarak */
+static void put_xy(uint8_t *p, int x, int y)
+{
+    int16_t v[2] = { (int16_t)x, (int16_t)y };
+    memcpy(p, v, sizeof(v));
+}
+
+static bool post_empty(uint8_t op)
+{
+    if (!SSD1322_Ring_Reserve(SSD1322_REMOTE_RING, op, 0, 0)) return false;
+    SSD1322_Ring_Commit(SSD1322_REMOTE_RING);
+    return true;
+}
+
+static bool post_ptr(uint8_t op, int x, int y, const void *ptr)
+{
+    uint8_t *p = SSD1322_Ring_Reserve(SSD1322_REMOTE_RING, op, 0, 4 + sizeof(ptr));
+    if (!p) return false;
+    put_xy(p, x, y);
+    memcpy(p + 4, &ptr, sizeof(ptr));
+    SSD1322_Ring_Commit(SSD1322_REMOTE_RING);
+    return true;
+}
+
+static bool post_text(uint8_t op, int a, int b, const char *s)
+{
+    size_t n = strlen(s) + 1;   // NUL dahil, tüketici doğrudan kullanır
+    if (n > 0xFFFF - 4) return false;
+    uint8_t *p = SSD1322_Ring_Reserve(SSD1322_REMOTE_RING, op, 0, (uint16_t)(4 + n));
+    if (!p) return false;
+    put_xy(p, a, b);
+    memcpy(p + 4, s, n);
+    SSD1322_Ring_Commit(SSD1322_REMOTE_RING);
+    return true;
+}
+
+void SSD1322_Remote_Init(void)
+{
+    SSD1322_Ring_Init(SSD1322_REMOTE_RING);
+}
+
+bool SSD1322_Remote_Clear(void)
+{
+    return post_empty(SSD1322_REMOTE_CLEAR);
+}
+
+bool SSD1322_Remote_SetPixel(int x, int y, uint8_t gray)
+{
+    uint8_t *p = SSD1322_Ring_Reserve(SSD1322_REMOTE_RING, SSD1322_REMOTE_PIXEL, gray, 4);
+    if (!p) return false;
+    put_xy(p, x, y);
+    SSD1322_Ring_Commit(SSD1322_REMOTE_RING);
+    return true;
+}
+
+bool SSD1322_Remote_DrawChar(int x, int y, char c)
+{
+    uint8_t *p = SSD1322_Ring_Reserve(SSD1322_REMOTE_RING, SSD1322_REMOTE_CHAR, (uint8_t)c, 4);
+    if (!p) return false;
+    put_xy(p, x, y);
+    SSD1322_Ring_Commit(SSD1322_REMOTE_RING);
+    return true;
+}
+
+bool SSD1322_Remote_DrawStringAtOffset(const char *s, int y, int offset)
+{
+    return post_text(SSD1322_REMOTE_TEXT, y, offset, s);
+}
+
+bool SSD1322_Remote_DrawCenteredAtY(const char *s, int y)
+{
+    return post_text(SSD1322_REMOTE_TEXT_CENTERED, y, 0, s);
+}
+
+/* Tanımlayıcı değer olarak kopyalanır (çağıranın yığınında olabilir), sadece data / mask flash'ı gösterir */
+bool SSD1322_Remote_DrawSprite(int x, int y, const ssd1322_sprite_t *spr)
+{
+    uint8_t *p = SSD1322_Ring_Reserve(SSD1322_REMOTE_RING, SSD1322_REMOTE_SPRITE, 0, 4 + sizeof(*spr));
+    if (!p) return false;
+    put_xy(p, x, y);
+    memcpy(p + 4, spr, sizeof(*spr));
+    SSD1322_Ring_Commit(SSD1322_REMOTE_RING);
+    return true;
+}
+
+bool SSD1322_Remote_DisplayImage(const uint8_t *img)
+{
+    return post_ptr(SSD1322_REMOTE_IMAGE, 0, 0, img);
+}
+
+bool SSD1322_Remote_Command(uint8_t cmd, const uint8_t *data, uint16_t len)
+{
+    uint8_t *p = SSD1322_Ring_Reserve(SSD1322_REMOTE_RING, SSD1322_REMOTE_COMMAND, cmd, len);
+    if (!p) return false;
+    if (len) memcpy(p, data, len);
+    SSD1322_Ring_Commit(SSD1322_REMOTE_RING);
+    return true;
+}
+
+bool SSD1322_Remote_Present(void)
+{
+    if (!post_empty(SSD1322_REMOTE_PRESENT)) return false;
+    SSD1322_REMOTE_NOTIFY();
+    return true;
+}
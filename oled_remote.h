@@ -0,0 +1,68 @@
+/* oled_remote.h */
+
+#ifndef OLED_REMOTE_H
+#define OLED_REMOTE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oled_ring.h"
+#include "oled_sprite.h"
+
+/*
+ * Çift çekirdek split modu.
+ * M7 (üretici) çizim komutlarını paylaşılan SRAM'deki halkaya yazar,
+ * M4 (tüketici) framebuf'a sahiptir, komutları çizer ve SPI'ı sürer.
+ *
+ *   M7: SSD1322_Remote_Init()  -> HSEM ile M4 serbest bırakılmadan önce
+ *       SSD1322_Remote_DrawXxx() / SSD1322_Remote_Present()
+ *   M4: SSD1322_Init(); for (;;) SSD1322_Remote_Service(0);
+ *
+ * Üretici tarafı tek bağlamdan çağrılmalıdır (SPSC).
+ * Sprite tanımlayıcısı halkaya kopyalanır; sprite / image verisi pointer
+ * olarak gider: flash'ta (iki çekirdeğin de gördüğü adreste) olmalıdır.
+ *
+ * Halka adresi iki imajda aynı olmalı: SSD1322_REMOTE_RING_ADDR ile sabit
+ * adres (ör. SRAM4 0x38000000) verilir; verilmezse normal bir global
+ * kullanılır (tek imaj / Linux iki thread).
+ */
+#ifdef SSD1322_REMOTE_RING_ADDR
+#define SSD1322_REMOTE_RING ((ssd1322_ring_t *)(SSD1322_REMOTE_RING_ADDR))
+#else
+extern ssd1322_ring_t ssd1322_remote_ring;
+#define SSD1322_REMOTE_RING (&ssd1322_remote_ring)
+#endif
+
+/* Present sonrası M4'ü uyandırmak için (ör. HSEM notification), varsayılan boş */
+#ifndef SSD1322_REMOTE_NOTIFY
+#define SSD1322_REMOTE_NOTIFY()
+#endif
+
+/* Komut kodları (ssd1322_ring_hdr_t.op) */
+enum {
+    SSD1322_REMOTE_CLEAR = 1,     // framebuf temizle
+    SSD1322_REMOTE_PIXEL,         // arg=gri, x,y
+    SSD1322_REMOTE_CHAR,          // arg=karakter, x,y
+    SSD1322_REMOTE_TEXT,          // y, offset, string
+    SSD1322_REMOTE_TEXT_CENTERED, // y, string
+    SSD1322_REMOTE_SPRITE,        // x, y, ssd1322_sprite_t (değer olarak)
+    SSD1322_REMOTE_IMAGE,         // const uint8_t *
+    SSD1322_REMOTE_COMMAND,       // arg=komut, veri byte'ları
+    SSD1322_REMOTE_PRESENT,       // RefreshFromFramebuffer
+};
+
+/* M7 tarafı: halka doluysa false döner, komut düşer */
+void SSD1322_Remote_Init(void);
+bool SSD1322_Remote_Clear(void);
+bool SSD1322_Remote_SetPixel(int x, int y, uint8_t gray);
+bool SSD1322_Remote_DrawChar(int x, int y, char c);
+bool SSD1322_Remote_DrawStringAtOffset(const char *s, int y, int offset);
+bool SSD1322_Remote_DrawCenteredAtY(const char *s, int y);
+bool SSD1322_Remote_DrawSprite(int x, int y, const ssd1322_sprite_t *spr);
+bool SSD1322_Remote_DisplayImage(const uint8_t *img);
+bool SSD1322_Remote_Command(uint8_t cmd, const uint8_t *data, uint16_t len);
+bool SSD1322_Remote_Present(void);
+
+/* M4 tarafı: en fazla max komut işler (0 = halka boşalana kadar), işlenen sayıyı döner */
+int  SSD1322_Remote_Service(int max);
+
+#endif /* OLED_REMOTE_H */
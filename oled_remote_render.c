@@ -0,0 +1,80 @@
+/* oled_remote_render.c - M4 (tüketici) tarafı: framebuf ve SPI bu çekirdekte */
+
+#include <string.h>
+#include "oled_remote.h"
+
+static void get_xy(const uint8_t *p, int *x, int *y)
+{
+    int16_t v[2];
+    memcpy(v, p, sizeof(v));
+    *x = v[0];
+    *y = v[1];
+}
+
+static const void *get_ptr(const uint8_t *p)
+{
+    const void *ptr;
+    memcpy(&ptr, p + 4, sizeof(ptr));
+    return ptr;
+}
+
+static void remote_exec(const ssd1322_ring_hdr_t *h)
+{
+    const uint8_t *p = (const uint8_t *)(h + 1);
+    int x, y;
+
+    switch (h->op) {
+        case SSD1322_REMOTE_CLEAR:
+            SSD1322_ClearFramebuffer();
+            break;
+        case SSD1322_REMOTE_PIXEL:
+            get_xy(p, &x, &y);
+            SSD1322_SetPixel(x, y, h->arg);
+            break;
+        case SSD1322_REMOTE_CHAR:
+            get_xy(p, &x, &y);
+            SSD1322_DrawChar(x, y, (char)h->arg);
+            break;
+        case SSD1322_REMOTE_TEXT:
+            get_xy(p, &y, &x);   // y, offset
+            SSD1322_DrawStringAtOffset((const char *)(p + 4), y, x);
+            break;
+        case SSD1322_REMOTE_TEXT_CENTERED:
+            get_xy(p, &y, &x);
+            draw_centered_at_y((const char *)(p + 4), y);
+            break;
+        case SSD1322_REMOTE_SPRITE: {
+            ssd1322_sprite_t spr;
+            get_xy(p, &x, &y);
+            memcpy(&spr, p + 4, sizeof(spr));   // halkada hizasız olabilir
+            SSD1322_DrawSprite(x, y, &spr);
+            break;
+        }
+        case SSD1322_REMOTE_IMAGE:
+            SSD1322_DisplayImage((const uint8_t *)get_ptr(p));
+            break;
+        case SSD1322_REMOTE_COMMAND:
+            SSD1322_SendCommandWithData(h->arg, p, h->len);
+            break;
+#ifndef SSD1322_NO_FRAMEBUFFER
+        case SSD1322_REMOTE_PRESENT:
+            SSD1322_RefreshFromFramebuffer();
+            break;
+#endif
+        default:
+            break;   // bilinmeyen komut atlanır
+    }
+}
+
+int SSD1322_Remote_Service(int max)
+{
+    int done = 0;
+    const ssd1322_ring_hdr_t *h;
+
+    while ((max <= 0 || done < max) && (h = SSD1322_Ring_Peek(SSD1322_REMOTE_RING)) != NULL) {
+        remote_exec(h);
+        SSD1322_Ring_Release(SSD1322_REMOTE_RING);
+        done++;
+    }
+    return done;
+}
@@ -0,0 +1,78 @@
+/* oled_ring.c */
+
+#include <stddef.h>
+#include "oled_ring.h"
+
+#define RING_MASK       (SSD1322_RING_SIZE - 1u)
+#define REC_SIZE(len)   ((uint32_t)(sizeof(ssd1322_ring_hdr_t) + (len) + 3u) & ~3u)
+
+void SSD1322_Ring_Init(ssd1322_ring_t *r)
+{
+    atomic_store_explicit(&r->head, 0, memory_order_relaxed);
+    atomic_store_explicit(&r->tail, 0, memory_order_relaxed);
+    r->reserved_at = 0;
+    r->reserved_size = 0;
+}
+
+uint8_t *SSD1322_Ring_Reserve(ssd1322_ring_t *r, uint8_t op, uint8_t arg, uint16_t len)
+{
+    uint32_t need = REC_SIZE(len);
+    if (need > SSD1322_RING_SIZE) return NULL;
+
+    uint32_t head = atomic_load_explicit(&r->head, memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(&r->tail, memory_order_acquire);
+    uint32_t off = head & RING_MASK;
+    uint32_t to_end = SSD1322_RING_SIZE - off;
+    uint32_t pad = (to_end < need) ? to_end : 0;
+
+    if (SSD1322_RING_SIZE - (head - tail) < pad + need) return NULL;   // dolu
+
+    if (pad) {
+        /* sona sığmıyor: kalan kısmı PAD ile kapat, başa dön */
+        ssd1322_ring_hdr_t *p = (ssd1322_ring_hdr_t *)&r->data[off];
+        p->op = SSD1322_RING_OP_PAD;
+        p->arg = 0;
+        p->len = (uint16_t)(to_end - sizeof(ssd1322_ring_hdr_t));
+        head += pad;
+        off = 0;
+    }
+
+    ssd1322_ring_hdr_t *h = (ssd1322_ring_hdr_t *)&r->data[off];
+    h->op = op;
+    h->arg = arg;
+    h->len = len;
+
+    r->reserved_at = head;
+    r->reserved_size = need;
+    return (uint8_t *)(h + 1);
+}
+
+void SSD1322_Ring_Commit(ssd1322_ring_t *r)
+{
+    /* release: payload yazımları head'den önce görünür */
+    atomic_store_explicit(&r->head, r->reserved_at + r->reserved_size, memory_order_release);
+    r->reserved_size = 0;
+}
+
+const ssd1322_ring_hdr_t *SSD1322_Ring_Peek(ssd1322_ring_t *r)
+{
+    uint32_t tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+
+    for (;;) {
+        uint32_t head = atomic_load_explicit(&r->head, memory_order_acquire);
+        if (tail == head) return NULL;
+
+        const ssd1322_ring_hdr_t *h = (const ssd1322_ring_hdr_t *)&r->data[tail & RING_MASK];
+        if (h->op != SSD1322_RING_OP_PAD) return h;
+
+        tail += REC_SIZE(h->len);
+        atomic_store_explicit(&r->tail, tail, memory_order_release);
+    }
+}
+
+void SSD1322_Ring_Release(ssd1322_ring_t *r)
+{
+    uint32_t tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+    const ssd1322_ring_hdr_t *h = (const ssd1322_ring_hdr_t *)&r->data[tail & RING_MASK];
+    atomic_store_explicit(&r->tail, tail + REC_SIZE(h->len), memory_order_release);
+}
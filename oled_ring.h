@@ -0,0 +1,52 @@
+/* oled_ring.h */
+
+#ifndef OLED_RING_H
+#define OLED_RING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+/*
+ * Lock-free tek üretici / tek tüketici kayıt halkası.
+ * Kayıtlar değişken uzunlukta: 4 byte başlık + payload, 4 byte hizalı.
+ * Halkanın sonuna sığmayan kayıt için bir PAD kaydı yazılıp başa dönülür.
+ *
+ * head sadece üretici, tail sadece tüketici tarafından yazılır;
+ * payload'lar release/acquire sırası ile görünür olur.
+ * Çift çekirdekte (M7 -> M4) halka paylaşılan SRAM'de ve M7 tarafında
+ * cache'lenmeyen (MPU) bir bölgede olmalıdır.
+ */
+#ifndef SSD1322_RING_SIZE
+#define SSD1322_RING_SIZE 4096u          // 2'nin kuvveti olmalı
+#endif
+
+#define SSD1322_RING_OP_PAD 0xFFu
+
+typedef struct {
+    uint8_t  op;
+    uint8_t  arg;          // kısa parametre (op'a özel)
+    uint16_t len;          // payload uzunluğu (byte)
+} ssd1322_ring_hdr_t;
+
+typedef struct {
+    _Atomic uint32_t head;               // toplam yazılan byte (üretici)
+    uint32_t pad0[7];                    // head/tail ayrı cache satırında
+    _Atomic uint32_t tail;               // toplam okunan byte (tüketici)
+    uint32_t pad1[7];
+    uint32_t reserved_at;                // üreticinin açık rezervasyonu
+    uint32_t reserved_size;
+    uint8_t  data[SSD1322_RING_SIZE];
+} ssd1322_ring_t;
+
+void SSD1322_Ring_Init(ssd1322_ring_t *r);
+
+/* Üretici: len byte payload için yer ayırır, doluysa NULL */
+uint8_t *SSD1322_Ring_Reserve(ssd1322_ring_t *r, uint8_t op, uint8_t arg, uint16_t len);
+void     SSD1322_Ring_Commit(ssd1322_ring_t *r);
+
+/* Tüketici: sıradaki kaydın başlığı (payload hemen arkasında), boşsa NULL */
+const ssd1322_ring_hdr_t *SSD1322_Ring_Peek(ssd1322_ring_t *r);
+void     SSD1322_Ring_Release(ssd1322_ring_t *r);
+
+#endif /* OLED_RING_H */
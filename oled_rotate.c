@@ -0,0 +1,105 @@
+/* oled_rotate.c */
+
+#include <string.h>
+#include "oled_rotate.h"
+
+#define REMAP_A_DEFAULT 0x16u     // Init'teki 0xA0 değerleri
+#define REMAP_B_DEFAULT 0x11u
+#define REMAP_H_FLIP    0x06u     // kolon + nibble
+#define REMAP_V_FLIP    0x10u     // COM tarama
+
+static uint8_t orientation;
+
+void SSD1322_SetOrientation(uint8_t o)
+{
+    bool hflip = (o & SSD1322_MIRROR_X) != 0;
+    bool vflip = (o & SSD1322_MIRROR_Y) != 0;
+
+    /* 180 ve 270 = (0 / 90) + her iki ayna */
+    if (o & SSD1322_ROTATE_180) {
+        hflip = !hflip;
+        vflip = !vflip;
+    }
+
+    uint8_t a = REMAP_A_DEFAULT;
+    if (hflip) a ^= REMAP_H_FLIP;
+    if (vflip) a ^= REMAP_V_FLIP;
+    SSD1322_SetRemap(a, REMAP_B_DEFAULT);
+    SSD1322_SetColumnOffset(hflip ? SSD1322_MIRROR_COL_OFFSET : 0);
+
+    orientation = o;
+}
+
+uint8_t SSD1322_GetOrientation(void)
+{
+    return orientation;
+}
+
+#ifndef SSD1322_NO_FRAMEBUFFER
+
+uint8_t ssd1322_portrait[SSD1322_PORTRAIT_HEIGHT][SSD1322_PORTRAIT_WIDTH];
+static ssd1322_surface_t portrait_surface;
+
+void SSD1322_Portrait_Begin(void)
+{
+    SSD1322_SurfaceInit(&portrait_surface, &ssd1322_portrait[0][0],
+                        SSD1322_PORTRAIT_WIDTH, SSD1322_PORTRAIT_HEIGHT, 0);
+    SSD1322_SetTarget(&portrait_surface);
+}
+
+void SSD1322_Portrait_End(void)
+{
+    SSD1322_SetTarget(NULL);
+}
+
+/*
+ * 8x8 byte bloğunu yerinde transpoze eder: r[i] i. satır, byte k = k. kolon
+ * (little-endian). Üç adımda 4x4, 2x2 ve 1x1 alt bloklar yer değiştirir.
+ */
+static void transpose8x8(uint64_t r[8])
+{
+    for (int i = 0; i < 4; i++) {
+        uint64_t t = ((r[i] >> 32) ^ r[i + 4]) & 0x00000000FFFFFFFFull;
+        r[i + 4] ^= t;
+        r[i] ^= t << 32;
+    }
+    static const uint8_t half[4] = { 0, 1, 4, 5 };
+    for (int j = 0; j < 4; j++) {
+        int i = half[j];
+        uint64_t t = ((r[i] >> 16) ^ r[i + 2]) & 0x0000FFFF0000FFFFull;
+        r[i + 2] ^= t;
+        r[i] ^= t << 16;
+    }
+    for (int i = 0; i < 8; i += 2) {
+        uint64_t t = ((r[i] >> 8) ^ r[i + 1]) & 0x00FF00FF00FF00FFull;
+        r[i + 1] ^= t;
+        r[i] ^= t << 8;
+    }
+}
+
+/*
+ * framebuf[y][x] = portrait[x][63 - y]  (portre 90° saat yönünde)
+ * Blok blok: 8 portre satırı okunur, transpoze edilir, 8 framebuf satırına yazılır.
+ */
+void SSD1322_Portrait_Transpose(void)
+{
+    uint64_t r[8];
+
+    for (int py = 0; py < SSD1322_PORTRAIT_HEIGHT; py += 8) {
+        for (int px = 0; px < SSD1322_PORTRAIT_WIDTH; px += 8) {
+            for (int i = 0; i < 8; i++)
+                memcpy(&r[i], &ssd1322_portrait[py + i][px], 8);
+            transpose8x8(r);
+            for (int k = 0; k < 8; k++)
+                memcpy(&framebuf[SSD1322_HEIGHT - 1 - (px + k)][py], &r[k], 8);
+        }
+    }
+}
+
+void SSD1322_Portrait_Present(void)
+{
+    SSD1322_Portrait_Transpose();
+    SSD1322_RefreshFromFramebuffer();
+}
+
+#endif /* SSD1322_NO_FRAMEBUFFER */
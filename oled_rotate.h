@@ -0,0 +1,54 @@
+/* oled_rotate.h */
+
+#ifndef OLED_ROTATE_H
+#define OLED_ROTATE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oled_ssd1322.h"
+
+/*
+ * Ekran yönü.
+ * 0° / 180° ve aynalar sadece remap register'ı (0xA0) ile yapılır,
+ * piksel başına maliyet yoktur:
+ *   A[1] kolon adresi ters, A[2] nibble sırası ters  -> yatay ayna
+ *   A[4] COM tarama yönü ters                          -> dikey ayna
+ * 180° = yatay + dikey ayna.
+ *
+ * 90° / 270° (portre): uygulama 64x128'lik portre yüzeyine çizer
+ * (SSD1322_Portrait_Begin), SSD1322_Portrait_Present 8x8 bloklar halinde
+ * transpoze edip framebuf'a yazar ve gönderir. 270° aynı transpoz + 180°
+ * remap'tir, ek maliyeti yoktur.
+ *
+ * SSD1322_Init remap'i varsayılana döndürür; yön Init'ten sonra verilir.
+ */
+
+/* Yatay aynada kolon adresi kayması (panelin GDDRAM penceresine göre) */
+#ifndef SSD1322_MIRROR_COL_OFFSET
+#define SSD1322_MIRROR_COL_OFFSET 0
+#endif
+
+#define SSD1322_ROTATE_0        0x00
+#define SSD1322_ROTATE_90       0x01
+#define SSD1322_ROTATE_180      0x02
+#define SSD1322_ROTATE_270      0x03
+#define SSD1322_MIRROR_X        0x04
+#define SSD1322_MIRROR_Y        0x08
+
+/* Portre yüzeyi: 64 genişlik, 128 yükseklik */
+#define SSD1322_PORTRAIT_WIDTH  SSD1322_HEIGHT
+#define SSD1322_PORTRAIT_HEIGHT SSD1322_WIDTH
+
+void SSD1322_SetOrientation(uint8_t orientation);   // SSD1322_ROTATE_x | SSD1322_MIRROR_x
+uint8_t SSD1322_GetOrientation(void);
+
+#ifndef SSD1322_NO_FRAMEBUFFER
+extern uint8_t ssd1322_portrait[SSD1322_PORTRAIT_HEIGHT][SSD1322_PORTRAIT_WIDTH];
+
+void SSD1322_Portrait_Begin(void);     // hedef = portre yüzeyi
+void SSD1322_Portrait_End(void);       // hedef = framebuf
+void SSD1322_Portrait_Transpose(void); // portre -> framebuf (refresh yok)
+void SSD1322_Portrait_Present(void);   // Transpose + RefreshFromFramebuffer
+#endif
+
+#endif /* OLED_ROTATE_H */
@@ -0,0 +1,254 @@
+/* oled_server.c */
+
+#include <string.h>
+#include "oled_server.h"
+#include "oled_text.h"
+
+#define QUEUE_MASK (SSD1322_SERVER_QUEUE - 1u)
+
+/*
+ * Sınırlı MPSC kuyruk (slot başına sıra numarası).
+ * seq == pos      : slot boş, pos numaralı yazım için hazır
+ * seq == pos + 1  : slot dolu, pos numaralı okuma için hazır
+ * Okunan slotun seq'i pos + QUEUE yapılır (bir tur sonraki yazım).
+ */
+typedef struct {
+    _Atomic uint32_t seq;
+    ssd1322_request_t req;
+} server_slot_t;
+
+static server_slot_t slots[SSD1322_SERVER_QUEUE];
+static _Atomic uint32_t enq_pos;
+static uint32_t deq_pos;                         // sadece tüketici
+
+/* key başına en son gönderilen isteğin pos'u */
+static _Atomic uint32_t latest[SSD1322_SERVER_KEYS];
+static _Atomic uint32_t latest_present;
+
+static _Atomic uint32_t stat_submitted, stat_dropped;
+static uint32_t stat_coalesced, stat_executed;
+
+static ssd1322_text_t server_text;               // sadece server task'ı kullanır
+
+/*
+ * l, pos'tan sonra kuyruğa giren (henüz canlı) bir konum mu: [pos + 1, enq).
+ * İşaretli fark karşılaştırması, 2^31 gönderim boyunca boşta kalan bir key'in
+ * eski değerini "daha yeni" sayardı; pencere kontrolü sarmadan etkilenmez.
+ */
+static inline bool pos_newer(uint32_t l, uint32_t pos, uint32_t enq)
+{
+    return (uint32_t)(l - pos - 1u) < (uint32_t)(enq - pos - 1u);
+}
+
+/* latest = max(latest, pos); aynı key'i gönderen üreticiler yarışabilir */
+static void latest_raise(_Atomic uint32_t *l, uint32_t pos)
+{
+    uint32_t cur = atomic_load_explicit(l, memory_order_relaxed);
+    while (!pos_newer(cur, pos, atomic_load_explicit(&enq_pos, memory_order_relaxed)) &&
+           !atomic_compare_exchange_weak_explicit(l, &cur, pos, memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+void SSD1322_Server_Init(void)
+{
+    const uint32_t p0 = SSD1322_SERVER_POS0;
+    for (uint32_t i = 0; i < SSD1322_SERVER_QUEUE; i++) {
+        uint32_t pos = p0 + ((i - p0) & QUEUE_MASK);    // bu slotu kullanacak ilk konum
+        atomic_store_explicit(&slots[i].seq, pos, memory_order_relaxed);
+    }
+    for (uint32_t i = 0; i < SSD1322_SERVER_KEYS; i++)
+        atomic_store_explicit(&latest[i], p0 - 1u, memory_order_relaxed);
+    atomic_store_explicit(&latest_present, p0 - 1u, memory_order_relaxed);
+    atomic_store_explicit(&stat_submitted, 0, memory_order_relaxed);
+    atomic_store_explicit(&stat_dropped, 0, memory_order_relaxed);
+    stat_coalesced = stat_executed = 0;
+    deq_pos = p0;
+    atomic_store_explicit(&enq_pos, p0, memory_order_release);
+}
+
+bool SSD1322_Server_Submit(const ssd1322_request_t *req)
+{
+    if (req->key >= SSD1322_SERVER_KEYS) return false;
+
+    server_slot_t *slot;
+    uint32_t pos = atomic_load_explicit(&enq_pos, memory_order_relaxed);
+    for (;;) {
+        slot = &slots[pos & QUEUE_MASK];
+        uint32_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        int32_t diff = (int32_t)(seq - pos);
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&enq_pos, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed))
+                break;
+        } else if (diff < 0) {
+            atomic_fetch_add_explicit(&stat_dropped, 1, memory_order_relaxed);   // dolu
+            return false;
+        } else {
+            pos = atomic_load_explicit(&enq_pos, memory_order_relaxed);
+        }
+    }
+
+    slot->req = *req;
+    if (req->op == SSD1322_SERVER_PRESENT) latest_raise(&latest_present, pos);
+    else if (req->key)                     latest_raise(&latest[req->key], pos);
+
+    /* release: istek içeriği seq'ten önce görünür */
+    atomic_store_explicit(&slot->seq, pos + 1, memory_order_release);
+    atomic_fetch_add_explicit(&stat_submitted, 1, memory_order_relaxed);
+    SSD1322_SERVER_NOTIFY();
+    return true;
+}
+
+static bool submit_op(uint8_t op, uint16_t key, int x, int y, int w, int h, uint8_t gray)
+{
+    ssd1322_request_t r;
+    r.op = op;
+    r.gray = gray;
+    r.key = key;
+    r.x = (int16_t)x;
+    r.y = (int16_t)y;
+    r.w = (int16_t)w;
+    r.h = (int16_t)h;
+    return SSD1322_Server_Submit(&r);
+}
+
+bool SSD1322_Server_Clear(void)
+{
+    return submit_op(SSD1322_SERVER_CLEAR, 0, 0, 0, 0, 0, 0);
+}
+
+bool SSD1322_Server_FillRect(uint16_t key, int x, int y, int w, int h, uint8_t gray)
+{
+    return submit_op(SSD1322_SERVER_FILL_RECT, key, x, y, w, h, gray);
+}
+
+bool SSD1322_Server_Text(uint16_t key, int x, int y, int w, int h, uint8_t flags, const char *s)
+{
+    ssd1322_request_t r;
+    r.op = SSD1322_SERVER_TEXT;
+    r.gray = flags;
+    r.key = key;
+    r.x = (int16_t)x;
+    r.y = (int16_t)y;
+    r.w = (int16_t)w;
+    r.h = (int16_t)h;
+
+    /* sığmayan metin UTF-8 karakter sınırında kesilir */
+    size_t n = strlen(s);
+    if (n > SSD1322_SERVER_TEXT_MAX - 1) {
+        n = SSD1322_SERVER_TEXT_MAX - 1;
+        while (n > 0 && ((uint8_t)s[n] & 0xC0) == 0x80) n--;
+    }
+    memcpy(r.u.text, s, n);
+    r.u.text[n] = 0;
+    return SSD1322_Server_Submit(&r);
+}
+
+bool SSD1322_Server_Sprite(uint16_t key, int x, int y, const ssd1322_sprite_t *spr)
+{
+    ssd1322_request_t r;
+    r.op = SSD1322_SERVER_SPRITE;
+    r.gray = 0;
+    r.key = key;
+    r.x = (int16_t)x;
+    r.y = (int16_t)y;
+    r.w = (int16_t)spr->w;
+    r.h = (int16_t)spr->h;
+    r.u.spr = *spr;
+    return SSD1322_Server_Submit(&r);
+}
+
+bool SSD1322_Server_Call(uint16_t key, ssd1322_server_fn fn, void *ctx)
+{
+    ssd1322_request_t r;
+    r.op = SSD1322_SERVER_CALL;
+    r.gray = 0;
+    r.key = key;
+    r.x = r.y = r.w = r.h = 0;
+    r.u.call.fn = fn;
+    r.u.call.ctx = ctx;
+    return SSD1322_Server_Submit(&r);
+}
+
+bool SSD1322_Server_Present(void)
+{
+    return submit_op(SSD1322_SERVER_PRESENT, 0, 0, 0, 0, 0, 0);
+}
+
+static void server_exec(const ssd1322_request_t *r)
+{
+    switch (r->op) {
+        case SSD1322_SERVER_CLEAR:
+            SSD1322_FillRect(0, 0, SSD1322_WIDTH, SSD1322_HEIGHT, 0);
+            SSD1322_MarkAllDirty();
+            break;
+        case SSD1322_SERVER_FILL_RECT:
+            SSD1322_FillRect(r->x, r->y, r->w, r->h, r->gray);
+            SSD1322_MarkDirty(r->x, r->y, r->x + r->w - 1, r->y + r->h - 1);
+            break;
+        case SSD1322_SERVER_TEXT:
+            SSD1322_FillRect(r->x, r->y, r->w, r->h, 0);
+            SSD1322_Text_Init(&server_text, r->u.text, r->x, r->y, r->w, r->h, r->gray);
+            SSD1322_Text_Draw(&server_text);
+            SSD1322_MarkDirty(r->x, r->y, r->x + r->w - 1, r->y + r->h - 1);
+            break;
+        case SSD1322_SERVER_SPRITE:
+            SSD1322_DrawSprite(r->x, r->y, &r->u.spr);
+            SSD1322_MarkDirty(r->x, r->y, r->x + r->w - 1, r->y + r->h - 1);
+            break;
+        case SSD1322_SERVER_CALL:
+            r->u.call.fn(r->u.call.ctx);
+            break;
+        case SSD1322_SERVER_PRESENT:
+#ifndef SSD1322_NO_FRAMEBUFFER
+            SSD1322_RefreshDirty();
+#endif
+            break;
+        default:
+            break;
+    }
+}
+
+int SSD1322_Server_Run(int max)
+{
+    int done = 0;
+    while (max <= 0 || done < max) {
+        server_slot_t *slot = &slots[deq_pos & QUEUE_MASK];
+        uint32_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        if (seq != deq_pos + 1) break;            // boş (ya da üretici henüz yazıyor)
+
+        /* kopyala, slotu hemen bırak: uzun çizim sırasında üreticiler beklemez */
+        ssd1322_request_t r = slot->req;
+        uint32_t pos = deq_pos++;
+        atomic_store_explicit(&slot->seq, pos + SSD1322_SERVER_QUEUE, memory_order_release);
+
+        _Atomic uint32_t *l = r.op == SSD1322_SERVER_PRESENT ? &latest_present
+                            : r.key ? &latest[r.key] : 0;
+        if (l && pos_newer(atomic_load_explicit(l, memory_order_relaxed), pos,
+                           atomic_load_explicit(&enq_pos, memory_order_relaxed))) {
+            stat_coalesced++;                      // daha yenisi kuyrukta
+        } else {
+            server_exec(&r);
+            stat_executed++;
+        }
+        done++;
+    }
+    return done;
+}
+
+void SSD1322_Server_GetStats(ssd1322_server_stats_t *out)
+{
+    out->submitted = atomic_load_explicit(&stat_submitted, memory_order_relaxed);
+    out->dropped = atomic_load_explicit(&stat_dropped, memory_order_relaxed);
+    out->coalesced = stat_coalesced;
+    out->executed = stat_executed;
+}
+
+#ifdef SSD1322_SERVER_TEST
+void SSD1322_Server_TestAgeKey(uint16_t key, uint32_t age)
+{
+    if (key >= SSD1322_SERVER_KEYS) return;
+    atomic_store_explicit(&latest[key], atomic_load_explicit(&enq_pos, memory_order_relaxed) - age,
+                          memory_order_relaxed);
+}
+#endif
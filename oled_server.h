@@ -0,0 +1,99 @@
+/* oled_server.h */
+
+#ifndef OLED_SERVER_H
+#define OLED_SERVER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include "oled_ssd1322.h"
+#include "oled_sprite.h"
+
+/*
+ * Display server. Sürücüye (framebuf, hspi2) tek bir task sahip olur ve
+ * SSD1322_Server_Run() çağırır; diğer task'lar ve ISR'lar istekleri
+ * kilitsiz, sınırlı boyutlu bir çok üretici / tek tüketici kuyruğuna yazar.
+ *
+ * Kuyruk sabit boyutlu slotlardan oluşur (slot başına sıra numarası).
+ * Üretici tarafı kilitsizdir ve bloklamaz: kuyruk doluysa istek düşer,
+ * false döner. ISR'dan çağrılabilir.
+ *
+ * Birleştirme: key != 0 olan bir istek, aynı key ile sonradan gönderilmiş
+ * bir istek kuyruktaysa çalıştırılmadan atlanır. Key bir widget'ı (sabit
+ * bölgesi olan her şeyi) tanımlar; ara durumlar hiç çizilmez.
+ * Present istekleri kendi aralarında aynı şekilde birleşir.
+ */
+#ifndef SSD1322_SERVER_QUEUE
+#define SSD1322_SERVER_QUEUE 32u        // slot sayısı, 2'nin kuvveti olmalı
+#endif
+
+#ifndef SSD1322_SERVER_KEYS
+#define SSD1322_SERVER_KEYS  32u        // key 1..SSD1322_SERVER_KEYS-1
+#endif
+
+#ifndef SSD1322_SERVER_TEXT_MAX
+#define SSD1322_SERVER_TEXT_MAX 32      // TEXT isteğinde NUL dahil byte
+#endif
+
+/* Kuyruğun başlangıç konumu; sadece sarma testleri için değiştirilir (host/test_server.c, -D ile) */
+#ifndef SSD1322_SERVER_POS0
+#define SSD1322_SERVER_POS0  0u
+#endif
+
+/* İstek sonrası server task'ını uyandırmak için (ör. osThreadFlagsSet), varsayılan boş */
+#ifndef SSD1322_SERVER_NOTIFY
+#define SSD1322_SERVER_NOTIFY()
+#endif
+
+typedef void (*ssd1322_server_fn)(void *ctx);
+
+enum {
+    SSD1322_SERVER_CLEAR = 1,     // hedef temizlenir
+    SSD1322_SERVER_FILL_RECT,     // x,y,w,h, gray
+    SSD1322_SERVER_TEXT,          // kutu (x,y,w,h) temizlenir, text flags ile yerleşir
+    SSD1322_SERVER_SPRITE,        // x,y, sprite tanımlayıcısı kopyalanır, verisi flash'ta
+    SSD1322_SERVER_CALL,          // fn(ctx) server task'ında çalışır, kirli bölgeyi kendisi işaretler
+    SSD1322_SERVER_PRESENT,       // RefreshDirty
+};
+
+typedef struct {
+    uint8_t  op;
+    uint8_t  gray;                // FILL_RECT rengi / TEXT flags (SSD1322_TEXT_*)
+    uint16_t key;                 // 0 = birleştirme yok
+    int16_t  x, y, w, h;
+    union {
+        char text[SSD1322_SERVER_TEXT_MAX];
+        ssd1322_sprite_t spr;     // değer olarak: çağıranın kopyası geçici olabilir
+        struct { ssd1322_server_fn fn; void *ctx; } call;
+    } u;
+} ssd1322_request_t;
+
+typedef struct {
+    uint32_t submitted;           // kuyruğa giren
+    uint32_t dropped;             // kuyruk dolu
+    uint32_t coalesced;           // daha yenisi olduğu için atlanan
+    uint32_t executed;
+} ssd1322_server_stats_t;
+
+void SSD1322_Server_Init(void);
+
+/* Üretici tarafı (her bağlamdan), kuyruk doluysa false */
+bool SSD1322_Server_Submit(const ssd1322_request_t *req);
+bool SSD1322_Server_Clear(void);
+bool SSD1322_Server_FillRect(uint16_t key, int x, int y, int w, int h, uint8_t gray);
+bool SSD1322_Server_Text(uint16_t key, int x, int y, int w, int h, uint8_t flags, const char *s);
+bool SSD1322_Server_Sprite(uint16_t key, int x, int y, const ssd1322_sprite_t *spr);
+bool SSD1322_Server_Call(uint16_t key, ssd1322_server_fn fn, void *ctx);
+bool SSD1322_Server_Present(void);
+
+/* Sürücü task'ı: en fazla max istek işler (0 = kuyruk boşalana kadar), işlenen sayısını döner */
+int SSD1322_Server_Run(int max);
+
+void SSD1322_Server_GetStats(ssd1322_server_stats_t *out);
+
+#ifdef SSD1322_SERVER_TEST
+/* Test kancası: key'in son isteği age gönderim önceymiş gibi (host/test_server.c) */
+void SSD1322_Server_TestAgeKey(uint16_t key, uint32_t age);
+#endif
+
+#endif /* OLED_SERVER_H */
@@ -0,0 +1,152 @@
+/* oled_sprite.c */
+
+#include <string.h>
+#include "oled_sprite.h"
+
+/*
+ * İç döngü her adımda 4 hedef pikseli (framebuf'ta 4 byte = 1 word) işler.
+ * Word'ler little-endian kabul edilir (Cortex-M7/M4): en soldaki piksel düşük byte'ta.
+ */
+
+/* 2 adet 2bpp piksel (bir nibble) -> 2 framebuf byte'ı */
+static const uint16_t px2_lut[16] = {
+    0x0000, 0x0100, 0x0200, 0x0300, 0x0001, 0x0101, 0x0201, 0x0301,
+    0x0002, 0x0102, 0x0202, 0x0302, 0x0003, 0x0103, 0x0203, 0x0303,
+};
+
+/* 4 bitlik 1bpp maske (MSB = ilk piksel) -> 4 byte yazma maskesi */
+static const uint32_t mask1_lut[16] = {
+    0x00000000, 0xFF000000, 0x00FF0000, 0xFFFF0000,
+    0x0000FF00, 0xFF00FF00, 0x00FFFF00, 0xFFFFFF00,
+    0x000000FF, 0xFF0000FF, 0x00FF00FF, 0xFFFF00FF,
+    0x0000FFFF, 0xFF00FFFF, 0x00FFFFFF, 0xFFFFFFFF,
+};
+
+static inline uint32_t expand_2bpp(uint8_t b)
+{
+    return (uint32_t)px2_lut[b >> 4] | ((uint32_t)px2_lut[b & 0x0F] << 16);
+}
+
+/* p. pikselden başlayarak 4 adet 2bpp piksel; n = satırda kalan piksel */
+static inline uint8_t fetch_2bpp(const uint8_t *row, uint32_t p, int n)
+{
+    const uint8_t *s = row + (p >> 2);
+    unsigned sh = (p & 3u) * 2u;
+    uint8_t b = (uint8_t)(s[0] << sh);
+    if (sh && n > (int)(4u - (p & 3u))) b |= (uint8_t)(s[1] >> (8u - sh));
+    return b;
+}
+
+/* p. pikselden başlayarak 4 adet 4bpp piksel (MSB = ilk piksel) */
+static inline uint16_t fetch_4bpp(const uint8_t *row, uint32_t p, int n)
+{
+    const uint8_t *s = row + (p >> 1);
+    int need = (int)(((p & 1u) + (uint32_t)(n < 4 ? n : 4) + 1u) >> 1);
+    uint32_t v = (uint32_t)s[0] << 16;
+    if (need > 1) v |= (uint32_t)s[1] << 8;
+    if (need > 2) v |= s[2];
+    if (p & 1u) v <<= 4;
+    return (uint16_t)(v >> 8);
+}
+
+/* p. pikselden başlayarak 4 maske biti (düşük nibble, MSB = ilk piksel) */
+static inline uint8_t fetch_1bpp(const uint8_t *row, uint32_t p, int n)
+{
+    const uint8_t *s = row + (p >> 3);
+    unsigned sh = p & 7u;
+    uint16_t v = (uint16_t)(s[0] << 8);
+    if ((int)sh + (n < 4 ? n : 4) > 8) v |= s[1];
+    return (uint8_t)(((uint16_t)(v << sh) >> 12) & 0x0F);
+}
+
+bool SSD1322_SpriteSheet_Get(const ssd1322_sprite_sheet_t *sheet, uint16_t index, ssd1322_sprite_t *out)
+{
+    if (!sheet || !out || !sheet->cols || index >= sheet->count) return false;
+
+    uint16_t row = index / sheet->cols;
+    uint16_t col = index % sheet->cols;
+    uint32_t first_line = (uint32_t)row * sheet->cell_h;
+
+    out->data        = sheet->data + first_line * sheet->stride;
+    out->mask        = sheet->mask ? sheet->mask + first_line * sheet->mask_stride : NULL;
+    out->x0          = (uint16_t)(col * sheet->cell_w);
+    out->w           = sheet->cell_w;
+    out->h           = sheet->cell_h;
+    out->stride      = sheet->stride;
+    out->mask_stride = sheet->mask_stride;
+    out->bpp         = sheet->bpp;
+    out->key         = sheet->key;
+    return true;
+}
+
+void SSD1322_DrawSprite(int x, int y, const ssd1322_sprite_t *spr)
+{
+    if (!spr || !spr->data) return;
+
+    /* Kırpma: sprite başına bir kez, aktif hedefin clip alanına */
+    const ssd1322_surface_t *t = ssd1322_target;
+    int sx = 0, sy = 0, cw = spr->w, ch = spr->h;
+    if (x < t->clip_x0) { sx = t->clip_x0 - x; cw -= sx; x = t->clip_x0; }
+    if (y < t->clip_y0) { sy = t->clip_y0 - y; ch -= sy; y = t->clip_y0; }
+    if (x + cw > t->clip_x1 + 1) cw = t->clip_x1 + 1 - x;
+    if (y + ch > t->clip_y1 + 1) ch = t->clip_y1 + 1 - y;
+    if (cw <= 0 || ch <= 0) return;
+
+    const bool is4 = (spr->bpp == SSD1322_SPRITE_4BPP);
+    const bool keyed = !spr->mask && spr->key != SSD1322_SPRITE_NO_KEY;
+    const uint8_t  key2 = (uint8_t)((spr->key & 0x03) * 0x55);
+    const uint16_t key4 = (uint16_t)((spr->key & 0x0F) * 0x1111);
+
+    for (int r = 0; r < ch; r++) {
+        const uint8_t *srow = spr->data + (uint32_t)(sy + r) * spr->stride;
+        const uint8_t *mrow = spr->mask ? spr->mask + (uint32_t)(sy + r) * spr->mask_stride : NULL;
+        uint8_t *dst = SSD1322_TargetRow(y + r) + x;
+        uint32_t p = (uint32_t)spr->x0 + (uint32_t)sx;
+
+        for (int n = cw; n > 0; n -= 4, p += 4, dst += 4) {
+            uint32_t w, m = 0xFFFFFFFFu;
+
+            if (is4) {
+                uint16_t v = fetch_4bpp(srow, p, n);
+                w = ((v >> 14) & 3u) | (((v >> 10) & 3u) << 8) |
+                    (((v >> 6) & 3u) << 16) | (((uint32_t)(v >> 2) & 3u) << 24);
+                if (keyed) {
+                    uint16_t z = v ^ key4;
+                    uint16_t nz = (z | (z >> 1) | (z >> 2) | (z >> 3)) & 0x1111u;
+                    m = (((nz >> 12) & 1u) | (((nz >> 8) & 1u) << 8) |
+                         (((nz >> 4) & 1u) << 16) | ((uint32_t)(nz & 1u) << 24)) * 0xFFu;
+                }
+            } else {
+                uint8_t b = fetch_2bpp(srow, p, n);
+                w = expand_2bpp(b);
+                if (keyed) {
+                    uint8_t z = b ^ key2;
+                    m = expand_2bpp((uint8_t)((z | (z >> 1)) & 0x55u)) * 0xFFu;
+                }
+            }
+            if (mrow) m = mask1_lut[fetch_1bpp(mrow, p, n)];
+
+            if (n < 4) {
+                /* satır sonu: komşu satıra taşmamak için byte byte */
+                for (int i = 0; i < n; i++, w >>= 8, m >>= 8)
+                    if (m & 0xFFu) dst[i] = (uint8_t)w;
+                break;
+            }
+            if (m == 0xFFFFFFFFu) {
+                memcpy(dst, &w, 4);
+            } else if (m) {
+                uint32_t d;
+                memcpy(&d, dst, 4);
+                d = (d & ~m) | (w & m);
+                memcpy(dst, &d, 4);
+            }
+        }
+    }
+}
+
+void SSD1322_DrawSpriteFrame(int x, int y, const ssd1322_sprite_sheet_t *sheet, uint16_t index)
+{
+    ssd1322_sprite_t spr;
+    if (SSD1322_SpriteSheet_Get(sheet, index, &spr))
+        SSD1322_DrawSprite(x, y, &spr);
+}
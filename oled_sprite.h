@@ -0,0 +1,52 @@
+/* oled_sprite.h */
+
+#ifndef OLED_SPRITE_H
+#define OLED_SPRITE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oled_ssd1322.h"
+
+/*
+ * Sprite kaynak formatı: paketli piksel, her satır byte hizalı başlar,
+ * byte içinde MSB = en soldaki piksel (NHD_Logo ile aynı düzen).
+ *   2bpp: byte başına 4 piksel (0..3)
+ *   4bpp: byte başına 2 piksel (0..15, framebuffer'a >>2 ile yazılır)
+ */
+#define SSD1322_SPRITE_2BPP   2
+#define SSD1322_SPRITE_4BPP   4
+
+/* key alanı için: şeffaf renk yok, sprite tamamen opak */
+#define SSD1322_SPRITE_NO_KEY 0xFF
+
+typedef struct {
+    const uint8_t *data;      // paketli piksel verisi (ilk satırın başı)
+    const uint8_t *mask;      // opsiyonel 1bpp maske (1 = opak), NULL ise key kullanılır
+    uint16_t x0;              // satır içindeki ilk pikselin indeksi (atlas hücreleri için)
+    uint16_t w, h;
+    uint16_t stride;          // data satır genişliği (byte)
+    uint16_t mask_stride;     // mask satır genişliği (byte)
+    uint8_t  bpp;             // SSD1322_SPRITE_2BPP / SSD1322_SPRITE_4BPP
+    uint8_t  key;             // şeffaf kaynak değeri ya da SSD1322_SPRITE_NO_KEY
+} ssd1322_sprite_t;
+
+/* Sprite sheet / atlas: tüm ikonlar tek flash blob'unda, cols x N ızgara */
+typedef struct {
+    const uint8_t *data;
+    const uint8_t *mask;      // opsiyonel, atlasla aynı ızgarada 1bpp
+    uint16_t cell_w, cell_h;
+    uint16_t cols;            // atlas satırındaki hücre sayısı
+    uint16_t count;           // toplam hücre
+    uint16_t stride;          // atlas satır genişliği (byte)
+    uint16_t mask_stride;
+    uint8_t  bpp;
+    uint8_t  key;
+} ssd1322_sprite_sheet_t;
+
+bool SSD1322_SpriteSheet_Get(const ssd1322_sprite_sheet_t *sheet, uint16_t index, ssd1322_sprite_t *out);
+
+/* Aktif hedefe blit (refresh yapmaz). Kırpma sprite başına bir kez yapılır. */
+void SSD1322_DrawSprite(int x, int y, const ssd1322_sprite_t *spr);
+void SSD1322_DrawSpriteFrame(int x, int y, const ssd1322_sprite_sheet_t *sheet, uint16_t index);
+
+#endif /* OLED_SPRITE_H */
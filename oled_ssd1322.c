@@ -8,24 +8,60 @@
 /* Eğer logonuz büyükse, extern olarak alın */
 extern const uint8_t NHD_Logo[];
 
+static bool dc_data;        // DC pininin son seviyesi
+static bool ram_write;      // son komut Write RAM (0x5C)
+
 /* Inline kontrol helper'ları */
 static inline void CS_LOW (void) { HAL_GPIO_WritePin(SSD1322_CS_Port,  SSD1322_CS_Pin,  GPIO_PIN_RESET); }
 static inline void CS_HIGH(void) { HAL_GPIO_WritePin(SSD1322_CS_Port,  SSD1322_CS_Pin,  GPIO_PIN_SET);   }
-static inline void DC_CMD (void) { HAL_GPIO_WritePin(SSD1322_DC_Port,  SSD1322_DC_Pin,  GPIO_PIN_RESET); }
-static inline void DC_DAT (void) { HAL_GPIO_WritePin(SSD1322_DC_Port,  SSD1322_DC_Pin,  GPIO_PIN_SET);   }
+static inline void DC_CMD (void) { HAL_GPIO_WritePin(SSD1322_DC_Port,  SSD1322_DC_Pin,  GPIO_PIN_RESET); dc_data = false; }
+static inline void DC_DAT (void) { HAL_GPIO_WritePin(SSD1322_DC_Port,  SSD1322_DC_Pin,  GPIO_PIN_SET);   dc_data = true; }
 static inline void DEBUG_TOGGLE(void) { HAL_GPIO_TogglePin(DEBUG_PIN_PORT, DEBUG_PIN_PIN); }
 static inline void DEBUG_HIGH(void) { HAL_GPIO_WritePin(DEBUG_PIN_PORT, DEBUG_PIN_PIN, GPIO_PIN_SET); }
 static inline void DEBUG_LOW(void)  { HAL_GPIO_WritePin(DEBUG_PIN_PORT, DEBUG_PIN_PIN, GPIO_PIN_RESET); }
 
-/* SPI ile gönderim (retry) */
+/*
+ * Bağlantı durumu. Bir transfer hata verince bağlantı arızalı sayılır:
+ * sonraki transferler HAL'e gitmeden düşer (ana döngü beklemez), refresh
+ * fonksiyonları gönderemedikleri bölgeyi kirli işaretler.
+ * SSD1322_Recover_Poll üstel backoff ile yeniden dener.
+ */
+enum { LINK_OK, LINK_FAULT, LINK_RESET_LOW, LINK_RESET_WAIT };
+static uint8_t  link_state = LINK_OK;
+static uint32_t link_t;                 // durumun başladığı an
+static uint32_t link_backoff = SSD1322_RECOVER_MIN_MS;
+static bool     link_reinit;            // komut dizisi yeniden gönderilmeli
+static uint8_t  link_reinit_fails;
+static ssd1322_link_stats_t link_stats;
+static void   (*resync_cb)(void *ctx);
+static void    *resync_ctx;
+
+/* Bağlantıyı arızalı işaretler; DMA başlatma / hata kesmesinden de çağrılır */
+void SSD1322_LinkFault(HAL_StatusTypeDef ret, bool data_phase)
+{
+    link_stats.tx_errors++;
+    link_stats.last_status = (uint8_t)ret;
+    if (data_phase) {
+        link_stats.data_errors++;        // GDDRAM verisi: bölge tekrar gönderilir
+    } else {
+        link_stats.cmd_errors++;         // komut ya da parametresi: kontrolcü durumu belirsiz
+        link_reinit = true;
+    }
+    if (link_state == LINK_OK) {
+        link_state = LINK_FAULT;
+        link_t = HAL_GetTick();
+    }
+}
+
+/* SPI ile gönderim: tek deneme, arıza sırasında hiç denemez */
 static HAL_StatusTypeDef ssd1322_spi_tx(const uint8_t *data, uint16_t len)
 {
-    HAL_StatusTypeDef ret;
-    for (int attempt = 0; attempt < SSD1322_SPI_RETRY_MAX; ++attempt) {
-        ret = HAL_SPI_Transmit(&hspi2, (uint8_t*)data, len, 100);
-        if (ret == HAL_OK) return HAL_OK;
-        HAL_Delay(1);
+    if (link_state != LINK_OK) {
+        link_stats.skipped++;
+        return HAL_ERROR;
     }
+    HAL_StatusTypeDef ret = HAL_SPI_Transmit(&hspi2, (uint8_t*)data, len, SSD1322_SPI_TIMEOUT_MS);
+    if (ret != HAL_OK) SSD1322_LinkFault(ret, dc_data && ram_write);
     return ret;
 }
 
@@ -42,6 +78,7 @@ void SSD1322_EntireDisplayOff(void) {
 /* Komut gönderimi */
 void SSD1322_SendCommand(uint8_t cmd)
 {
+    ram_write = (cmd == 0x5C);
     DC_CMD();
     CS_LOW();
     ssd1322_spi_tx(&cmd, 1);
@@ -51,6 +88,7 @@ void SSD1322_SendCommand(uint8_t cmd)
 /* Komut + veri */
 void SSD1322_SendCommandWithData(uint8_t cmd, const uint8_t *data, uint16_t len)
 {
+    ram_write = false;
     DC_CMD();
     CS_LOW();
     ssd1322_spi_tx(&cmd, 1);
@@ -61,6 +99,26 @@ void SSD1322_SendCommandWithData(uint8_t cmd, const uint8_t *data, uint16_t len)
     CS_HIGH();
 }
 
+/* Veri akışı (Write RAM sonrası) */
+void SSD1322_DataBegin(void)
+{
+    DC_DAT();
+    CS_LOW();
+}
+
+void SSD1322_DataEnd(void)
+{
+    CS_HIGH();
+}
+
+void SSD1322_WriteData(const uint8_t *data, uint16_t len)
+{
+    DC_DAT();
+    CS_LOW();
+    ssd1322_spi_tx(data, len);
+    CS_HIGH();
+}
+
 /* Reset palsi */
 static void SSD1322_Reset(void)
 {
@@ -71,14 +129,85 @@ static void SSD1322_Reset(void)
 }
 
 /* Kolon/satır ayarları */
+/* Kolon adreslerine eklenen kayma (ayna modunda panel penceresi için) */
+static uint8_t col_offset;
+
 void SSD1322_SetColumn(uint8_t a, uint8_t b)
 {
-    SSD1322_SendCommandWithData(0x15, (uint8_t[]){a, b}, 2);
+    SSD1322_SendCommandWithData(0x15, (uint8_t[]){(uint8_t)(a + col_offset), (uint8_t)(b + col_offset)}, 2);
+}
+
+void SSD1322_SetColumnOffset(uint8_t off)
+{
+    col_offset = off;
 }
 
+/* Satır adresleri görünür sayfaya göredir (row_base eklenir) */
+static uint8_t row_base;
+
 void SSD1322_SetRow(uint8_t a, uint8_t b)
 {
-    SSD1322_SendCommandWithData(0x75, (uint8_t[]){a, b}, 2);
+    SSD1322_SendCommandWithData(0x75, (uint8_t[]){(uint8_t)((a + row_base) & 0x7F), (uint8_t)((b + row_base) & 0x7F)}, 2);
+}
+
+/* GDDRAM 128 satır: 64 satırlık görünür sayfa 0 ya da 64'ten başlar */
+void SSD1322_SetRowBase(uint8_t base)
+{
+    row_base = base & 0x7F;
+}
+
+uint8_t SSD1322_GetRowBase(void)
+{
+    return row_base;
+}
+
+/* Display offset (0xA2): COM eşlemesini kaydırır, görüntü 128 satırda döner */
+static uint8_t disp_offset;
+
+void SSD1322_SetDisplayOffset(uint8_t off)
+{
+    off &= 0x7F;
+    disp_offset = off;
+    SSD1322_SendCommandWithData(0xA2, &off, 1);
+}
+
+uint8_t SSD1322_GetDisplayOffset(void)
+{
+    return disp_offset;
+}
+
+/* Display start line (0xA1), 0..127 */
+void SSD1322_SetStartLine(uint8_t line)
+{
+    line &= 0x7F;
+    SSD1322_SendCommandWithData(0xA1, &line, 1);
+}
+
+/* Yeniden init'te geri yüklenen register kopyaları */
+static uint8_t remap_a = 0x16, remap_b = 0x11;
+static uint8_t contrast = SSD1322_CONTRAST_DEFAULT;
+static uint8_t master_contrast = SSD1322_MASTER_CONTRAST_DEFAULT;
+
+/* Remap (0xA0) */
+void SSD1322_SetRemap(uint8_t a, uint8_t b)
+{
+    remap_a = a;
+    remap_b = b;
+    SSD1322_SendCommandWithData(0xA0, (uint8_t[]){a, b}, 2);
+}
+
+/* Kontrast (parlaklık) */
+void SSD1322_SetContrast(uint8_t c)
+{
+    contrast = c;
+    SSD1322_SendCommandWithData(0xC1, &c, 1);
+}
+
+void SSD1322_SetMasterContrast(uint8_t m)
+{
+    m &= 0x0F;
+    master_contrast = m;
+    SSD1322_SendCommandWithData(0xC7, &m, 1);
 }
 
 /* Display ON/OFF */
@@ -88,24 +217,35 @@ void SSD1322_DisplayOnOff(bool on)
     else   SSD1322_SendCommand(0xAE);
 }
 
-/* Başlatma sekansı */
-void SSD1322_Init(void)
+/*
+ * Komut dizisi. restore: bağlantı kurtarmasında remap, start line,
+ * display offset, kolon kayması ve kontrast son değerleriyle yazılır.
+ */
+static void init_sequence(bool restore)
 {
-    SSD1322_Reset();
+    if (!restore) {
+        row_base = 0;
+        col_offset = 0;
+        disp_offset = 0;
+        remap_a = 0x16;
+        remap_b = 0x11;
+        contrast = SSD1322_CONTRAST_DEFAULT;
+        master_contrast = SSD1322_MASTER_CONTRAST_DEFAULT;
+    }
 
     SSD1322_DisplayOnOff(false);
 
     SSD1322_SendCommandWithData(0xFD, (uint8_t[]){0x12},1);    // Command Lock
     SSD1322_SendCommandWithData(0xB3, (uint8_t[]){0x91},1);    // Display Clock
     SSD1322_SendCommandWithData(0xCA, (uint8_t[]){0x3F},1);    // MUX Ratio
-    SSD1322_SendCommandWithData(0xA2, (uint8_t[]){0x00},1);    // Display Offset
+    SSD1322_SetDisplayOffset(disp_offset);                     // Display Offset
     SSD1322_SendCommandWithData(0xAB, (uint8_t[]){0x01},1);    // Function Select (internal VDD)
-    SSD1322_SendCommandWithData(0xA1, (uint8_t[]){0x00},1);    // Start Line
+    SSD1322_SetStartLine(row_base);                            // Start Line
 
-    SSD1322_SendCommandWithData(0xA0, (uint8_t[]){0x16,0x11},2);  // Remap
+    SSD1322_SetRemap(remap_a, remap_b);                        // Remap (0x16, 0x11)
 
-    SSD1322_SendCommandWithData(0xC7, (uint8_t[]){0x0F},1);    // Master Contrast
-    SSD1322_SendCommandWithData(0xC1, (uint8_t[]){0x9F},1);    // Contrast
+    SSD1322_SetMasterContrast(master_contrast);                // Master Contrast
+    SSD1322_SetContrast(contrast);                             // Contrast
 
     SSD1322_SendCommandWithData(0xB1, (uint8_t[]){0x72},1);    // Phase Length
     SSD1322_SendCommandWithData(0xBB, (uint8_t[]){0x1F},1);    // Precharge Voltage
@@ -122,8 +262,219 @@ void SSD1322_Init(void)
     SSD1322_DisplayOnOff(true);
 }
 
+/* Başlatma sekansı */
+void SSD1322_Init(void)
+{
+    link_state = LINK_OK;
+    link_backoff = SSD1322_RECOVER_MIN_MS;
+    link_reinit = false;
+    link_reinit_fails = 0;
+
+    SSD1322_Reset();
+    init_sequence(false);
+}
+
+/* Bağlantı kurtarma: arızalıysa true */
+bool SSD1322_Recover_Poll(uint32_t now_ms)
+{
+    switch (link_state) {
+        case LINK_OK:
+            return false;
+        case LINK_FAULT:
+            if ((uint32_t)(now_ms - link_t) < link_backoff) return true;
+            if (link_reinit && link_reinit_fails >= SSD1322_RECOVER_HARD_AFTER) {
+                /* yazılım init'i tutmadı: donanım reset'i, bloklamadan */
+                HAL_GPIO_WritePin(SSD1322_RST_Port, SSD1322_RST_Pin, GPIO_PIN_RESET);
+                link_state = LINK_RESET_LOW;
+                link_t = now_ms;
+                return true;
+            }
+            break;
+        case LINK_RESET_LOW:
+            if ((uint32_t)(now_ms - link_t) < SSD1322_RESET_MS) return true;
+            HAL_GPIO_WritePin(SSD1322_RST_Port, SSD1322_RST_Pin, GPIO_PIN_SET);
+            link_stats.hard_resets++;
+            link_state = LINK_RESET_WAIT;
+            link_t = now_ms;
+            return true;
+        case LINK_RESET_WAIT:
+            if ((uint32_t)(now_ms - link_t) < SSD1322_RESET_MS) return true;
+            link_reinit = true;
+            break;
+    }
+
+    /* yeniden dene: gerekirse init, sonra içeriği tekrar gönder */
+    bool reinit = link_reinit;
+    link_state = LINK_OK;
+    if (reinit) {
+        link_stats.reinits++;
+        init_sequence(true);
+#ifndef SSD1322_NO_FRAMEBUFFER
+        SSD1322_MarkAllDirty();
+#endif
+    }
+#ifndef SSD1322_NO_FRAMEBUFFER
+    if (link_state == LINK_OK) SSD1322_RefreshDirty();
+#endif
+    if (link_state == LINK_OK && resync_cb) resync_cb(resync_ctx);
+
+    if (link_state != LINK_OK) {
+        /* tekrar arıza: bekleme ikiye katlanır */
+        if (reinit) link_reinit_fails++;
+        link_t = now_ms;
+        link_backoff = link_backoff * 2 > SSD1322_RECOVER_MAX_MS ? SSD1322_RECOVER_MAX_MS : link_backoff * 2;
+        return true;
+    }
+
+    link_backoff = SSD1322_RECOVER_MIN_MS;
+    link_reinit = false;
+    link_reinit_fails = 0;
+    link_stats.recoveries++;
+    return false;
+}
+
+bool SSD1322_LinkOk(void)
+{
+    return link_state == LINK_OK;
+}
+
+void SSD1322_SetResyncCallback(void (*fn)(void *ctx), void *ctx)
+{
+    resync_cb = fn;
+    resync_ctx = ctx;
+}
+
+/* GDDRAM içeriği geçersiz (ör. yatay kayma): sahibi yeniden yazar */
+void SSD1322_Resync(void)
+{
+#ifndef SSD1322_NO_FRAMEBUFFER
+    if (!resync_cb) { SSD1322_RefreshFromFramebuffer(); return; }
+    SSD1322_MarkAllDirty();
+#endif
+    if (link_state == LINK_OK && resync_cb) resync_cb(resync_ctx);   // arızada kurtarma çağırır
+}
+
+void SSD1322_GetLinkStats(ssd1322_link_stats_t *out)
+{
+    *out = link_stats;
+    out->faulted = link_state != LINK_OK;
+}
+
+void SSD1322_ResetLinkStats(void)
+{
+    memset(&link_stats, 0, sizeof(link_stats));
+}
+
+#ifndef SSD1322_NO_FRAMEBUFFER
 /* Framebuffer: 2-bit grayscale (0..3), 64 satır x 128 kolon */
- uint8_t framebuf[64][128];
+ uint8_t framebuf[SSD1322_HEIGHT][SSD1322_WIDTH];
+
+static ssd1322_surface_t fb_surface = {
+    &framebuf[0][0], SSD1322_WIDTH, SSD1322_HEIGHT, SSD1322_WIDTH, 0,
+    0, 0, SSD1322_WIDTH - 1, SSD1322_HEIGHT - 1
+};
+#else
+/* Framebuffer yok: band dışında çizim hiçbir yere yazmaz */
+static ssd1322_surface_t fb_surface = { 0, 0, 0, 0, 0, 0, 0, -1, -1 };
+#endif
+
+ssd1322_surface_t *ssd1322_target = &fb_surface;
+
+void SSD1322_SurfaceInit(ssd1322_surface_t *s, uint8_t *pix, int w, int h, int y0)
+{
+    s->pix = pix;
+    s->w = (int16_t)w;
+    s->h = (int16_t)h;
+    s->stride = (int16_t)w;
+    s->y0 = (int16_t)y0;
+    s->clip_x0 = 0;
+    s->clip_y0 = (int16_t)y0;
+    s->clip_x1 = (int16_t)(w - 1);
+    s->clip_y1 = (int16_t)(y0 + h - 1);
+}
+
+void SSD1322_SetTarget(ssd1322_surface_t *s)
+{
+    ssd1322_target = s ? s : &fb_surface;
+}
+
+void SSD1322_SetClip(int x0, int y0, int x1, int y1)
+{
+    ssd1322_surface_t *t = ssd1322_target;
+    int bx1 = t->w - 1;
+    int by1 = t->y0 + t->h - 1;
+
+    t->clip_x0 = (int16_t)(x0 > 0 ? x0 : 0);
+    t->clip_y0 = (int16_t)(y0 > t->y0 ? y0 : t->y0);
+    t->clip_x1 = (int16_t)(x1 < bx1 ? x1 : bx1);
+    t->clip_y1 = (int16_t)(y1 < by1 ? y1 : by1);
+}
+
+void SSD1322_ResetClip(void)
+{
+    const ssd1322_surface_t *t = ssd1322_target;
+    SSD1322_SetClip(0, t->y0, t->w - 1, t->y0 + t->h - 1);
+}
+
+/* src'nin (sx, sy, w, h) dikdörtgenini hedefte (dx, dy)'ye kopyalar, kırpılır */
+void SSD1322_BlitSurface(int dx, int dy, const ssd1322_surface_t *src, int sx, int sy, int w, int h)
+{
+    const ssd1322_surface_t *t = ssd1322_target;
+
+    /* kaynak sınırları */
+    if (sx < 0) { dx -= sx; w += sx; sx = 0; }
+    if (sy < src->y0) { dy += src->y0 - sy; h -= src->y0 - sy; sy = src->y0; }
+    if (sx + w > src->w) w = src->w - sx;
+    if (sy + h > src->y0 + src->h) h = src->y0 + src->h - sy;
+
+    /* hedef clip */
+    if (dx < t->clip_x0) { sx += t->clip_x0 - dx; w -= t->clip_x0 - dx; dx = t->clip_x0; }
+    if (dx + w - 1 > t->clip_x1) w = t->clip_x1 - dx + 1;
+    if (w <= 0) return;
+
+    for (int r = 0; r < h; r++) {
+        uint8_t *line = SSD1322_TargetRow(dy + r);
+        if (line) memmove(line + dx, src->pix + (sy + r - src->y0) * src->stride + sx, (size_t)w);
+    }
+}
+
+/* Kirli satır aralıkları: dirty_x0 > dirty_x1 ise satır temiz */
+static uint8_t dirty_x0[SSD1322_HEIGHT];
+static uint8_t dirty_x1[SSD1322_HEIGHT];
+static bool dirty_any;
+
+static void dirty_reset(void)
+{
+    memset(dirty_x0, 0xFF, sizeof(dirty_x0));
+    memset(dirty_x1, 0x00, sizeof(dirty_x1));
+    dirty_any = false;
+}
+
+void SSD1322_MarkDirty(int x0, int y0, int x1, int y1)
+{
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > SSD1322_WIDTH - 1)  x1 = SSD1322_WIDTH - 1;
+    if (y1 > SSD1322_HEIGHT - 1) y1 = SSD1322_HEIGHT - 1;
+    if (x0 > x1 || y0 > y1) return;
+
+    if (!dirty_any) dirty_reset();
+    for (int y = y0; y <= y1; y++) {
+        if (x0 < dirty_x0[y]) dirty_x0[y] = (uint8_t)x0;
+        if (x1 > dirty_x1[y]) dirty_x1[y] = (uint8_t)x1;
+    }
+    dirty_any = true;
+}
+
+void SSD1322_MarkAllDirty(void)
+{
+    SSD1322_MarkDirty(0, 0, SSD1322_WIDTH - 1, SSD1322_HEIGHT - 1);
+}
+
+bool SSD1322_IsDirty(void)
+{
+    return dirty_any;
+}
 
 /* 2-bit -> byte mapping */
 static inline uint8_t gray2byte(uint8_t g) {
@@ -136,89 +487,235 @@ static inline uint8_t gray2byte(uint8_t g) {
     }
 }
 
+/* Gri satırı GDDRAM formatına çevirir (her piksel 2 byte) */
+void SSD1322_PackLine(uint8_t *out, const uint8_t *pix, int count)
+{
+    for (int col = 0; col < count; col++) {
+        uint8_t b = gray2byte(pix[col]);
+        out[col * 2 + 0] = b;
+        out[col * 2 + 1] = b;
+    }
+}
+
+static int8_t shift_x;   // framebuf / akış kolonlarının panel kayması
+
+void SSD1322_SetShiftX(int dx)
+{
+    shift_x = (int8_t)(dx < -SSD1322_SHIFT_MAX ? -SSD1322_SHIFT_MAX : dx > SSD1322_SHIFT_MAX ? SSD1322_SHIFT_MAX : dx);
+}
+
+int SSD1322_GetShiftX(void)
+{
+    return shift_x;
+}
+
+#ifndef SSD1322_NO_FRAMEBUFFER
+static void  (*present_cb)(void *ctx);
+static void   *present_ctx;
+static ssd1322_row_packer_t row_packer;
+
+void SSD1322_SetRowPacker(ssd1322_row_packer_t fn)
+{
+    row_packer = fn;
+}
+
+static void pack_row(uint8_t *out, int y, int x0, int n)
+{
+    if (row_packer) row_packer(out, y, x0, n);
+    else            SSD1322_PackLine(out, &framebuf[y][x0], n);
+}
+
+void SSD1322_PackRow(uint8_t *out, int y, int x0, int n)
+{
+    pack_row(out, y, x0, n);
+}
+
+void SSD1322_SetPresentCallback(void (*fn)(void *ctx), void *ctx)
+{
+    present_cb = fn;
+    present_ctx = ctx;
+}
+
+static void present_done(void)
+{
+    if (present_cb) present_cb(present_ctx);
+}
+
 /* Framebuffer'ı GDDRAM'a yazar */
 void SSD1322_RefreshFromFramebuffer(void)
 {
+    if (link_state != LINK_OK) { SSD1322_MarkAllDirty(); present_done(); return; }
+
     SSD1322_SetColumn(COLUMN_START, COLUMN_END);
     SSD1322_SetRow(ROW_START, ROW_END);
     SSD1322_SendCommand(0x5C); // Write RAM
 
+    /* kaymada açılan kolonlar siyah, taşan kolonlar gönderilmez */
     uint8_t linebuf[256];
+    int dx = shift_x;
+    int src = dx < 0 ? -dx : 0, dst = dx > 0 ? dx : 0;
+    if (dx) memset(linebuf, 0, sizeof(linebuf));
     for (int row = 0; row < 64; row++) {
-        for (int col = 0; col < 128; col++) {
-            uint8_t b = gray2byte(framebuf[row][col]);
-            linebuf[col * 2 + 0] = b;
-            linebuf[col * 2 + 1] = b;
-        }
+        pack_row(linebuf + dst * 2, row, src, SSD1322_WIDTH - src - dst);
         DC_DAT();
         CS_LOW();
         ssd1322_spi_tx(linebuf, sizeof(linebuf));
         CS_HIGH();
     }
+    if (link_state == LINK_OK) dirty_reset();
+    else                       SSD1322_MarkAllDirty();   // yarım kaldı, kurtarmada tekrar
+    present_done();
+}
+
+/* Framebuffer'ın bir penceresini GDDRAM'a yazar (kolon adresi = piksel x) */
+void SSD1322_RefreshRegion(int x0, int y0, int x1, int y1)
+{
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > SSD1322_WIDTH - 1)  x1 = SSD1322_WIDTH - 1;
+    if (y1 > SSD1322_HEIGHT - 1) y1 = SSD1322_HEIGHT - 1;
+    if (x0 > x1 || y0 > y1) return;
+    if (link_state != LINK_OK) { SSD1322_MarkDirty(x0, y0, x1, y1); return; }
+
+    /* panelden taşan kolonlar (shift_x) atlanır */
+    if (x0 + shift_x < 0) x0 = -shift_x;
+    if (x1 + shift_x > SSD1322_WIDTH - 1) x1 = SSD1322_WIDTH - 1 - shift_x;
+    if (x0 > x1) return;
+
+    SSD1322_SetColumn((uint8_t)(COLUMN_START + x0 + shift_x), (uint8_t)(COLUMN_START + x1 + shift_x));
+    SSD1322_SetRow((uint8_t)(ROW_START + y0), (uint8_t)(ROW_START + y1));
+    SSD1322_SendCommand(0x5C); // Write RAM
+
+    uint8_t linebuf[256];
+    uint16_t n = (uint16_t)((x1 - x0 + 1) * 2);
+    for (int row = y0; row <= y1; row++) {
+        pack_row(linebuf, row, x0, x1 - x0 + 1);
+        DC_DAT();
+        CS_LOW();
+        ssd1322_spi_tx(linebuf, n);
+        CS_HIGH();
+    }
+    if (link_state != LINK_OK) SSD1322_MarkDirty(x0, y0, x1, y1);   // kurtarmada tekrar
+}
+
+/* Ardışık kirli satırları tek pencerede birleştirir */
+void SSD1322_RefreshDirty(void)
+{
+    if (!dirty_any) return;
+
+    /* kopya üzerinden: gönderilemeyen pencereler RefreshRegion'da tekrar işaretlenir */
+    uint8_t sx0[SSD1322_HEIGHT], sx1[SSD1322_HEIGHT];
+    memcpy(sx0, dirty_x0, sizeof(sx0));
+    memcpy(sx1, dirty_x1, sizeof(sx1));
+    dirty_reset();
+
+    int y = 0;
+    while (y < SSD1322_HEIGHT) {
+        if (sx0[y] > sx1[y]) { y++; continue; }
+        int y0 = y, x0 = sx0[y], x1 = sx1[y];
+        while (++y < SSD1322_HEIGHT && sx0[y] <= sx1[y]) {
+            if (sx0[y] < x0) x0 = sx0[y];
+            if (sx1[y] > x1) x1 = sx1[y];
+        }
+        SSD1322_RefreshRegion(x0, y0, x1, y - 1);
+    }
+    present_done();
 }
 
 /* Ekranı framebuffer üzerinden temizle */
 void SSD1322_Clear(void)
 {
-    for (int r=0; r<64; r++)
-        for (int c=0; c<128; c++)
-            framebuf[r][c] = 0;
+    SSD1322_ClearFramebuffer();
     SSD1322_RefreshFromFramebuffer();
 }
+#endif
 
-/* Basit karakter çizimi (6x8) */
-void SSD1322_DrawChar(int x, int y, char c)
+/* Aktif font (varsayılan Font6x8 + Türkçe) */
+static const ssd1322_font_t *cur_font = &Font6x8_TR;
+
+void SSD1322_SetFont(const ssd1322_font_t *f)
+{
+    cur_font = f ? f : &Font6x8_TR;
+}
+
+const ssd1322_font_t *SSD1322_GetFont(void)
 {
-    if (c < 32 || c > 127) return;
-    const uint8_t *glyph = Font6x8[c - 32];
-
-    for (int col = 0; col < 6; col++) {
-        int fx = x + col;
-        if (fx < 0 || fx >= 128) continue;
-        uint8_t column_bits = glyph[col];
-        for (int row = 0; row < 8; row++) {
-            int fy = y + row;
-            if (fy < 0 || fy >= 64) continue;
-            uint8_t pixel_on = (column_bits >> row) & 0x01;
-            framebuf[fy][fx] = pixel_on ? 3 : 0;
+    return cur_font;
+}
+
+/* Tek glif çizimi (Unicode kod noktası), olmayan glif yerine fallback */
+void SSD1322_DrawGlyph(int x, int y, uint32_t cp)
+{
+    const ssd1322_font_t *f = cur_font;
+    const uint8_t *glyph = SSD1322_FontGlyph(f, cp);
+    if (!glyph) glyph = SSD1322_FontGlyph(f, f->fallback);
+    if (glyph) SSD1322_DrawGlyphData(x, y, f, glyph);
+}
+
+void SSD1322_DrawGlyphData(int x, int y, const ssd1322_font_t *f, const uint8_t *glyph)
+{
+    const ssd1322_surface_t *t = ssd1322_target;
+
+    for (int row = 0; row < f->h; row++) {
+        uint8_t *line = SSD1322_TargetRow(y + row);
+        if (!line) continue;
+        const uint8_t *col_bits = glyph + (row >> 3);
+        uint8_t bit = (uint8_t)(row & 7);
+        for (int col = 0; col < f->w; col++, col_bits += f->col_bytes) {
+            int fx = x + col;
+            if (fx < t->clip_x0 || fx > t->clip_x1) continue;
+            uint8_t pixel_on = (*col_bits >> bit) & 0x01;
+            line[fx] = pixel_on ? 3 : 0;
         }
     }
 }
 
+/* Tek satır genişliği, aktif font */
+int SSD1322_TextWidth(const char *s)
+{
+    return SSD1322_FontTextWidth(cur_font, SSD1322_Utf8Length(s));
+}
+
+/* Basit karakter çizimi (6x8), c Latin-1 kabul edilir */
+void SSD1322_DrawChar(int x, int y, char c)
+{
+    if ((uint8_t)c < 32) return;
+    SSD1322_DrawGlyph(x, y, (uint8_t)c);
+}
+
+#ifndef SSD1322_NO_FRAMEBUFFER
 /* Ortalanmış string (tek satır) */
 void SSD1322_DrawStringCentered(const char *s)
 {
-    int len = 0;
-    for (const char *p = s; *p; ++p) len++;
-    int total_width = len * 6 + (len - 1) * 1;
-    int x0 = (128 - total_width) / 2;
+    int x0 = (128 - SSD1322_TextWidth(s)) / 2;
     int y0 = (64 - 8) / 2;
 
     /* temizle */
-    for (int r=0;r<64;r++)
-        for (int c=0;c<128;c++)
-            framebuf[r][c]=0;
+    SSD1322_ClearFramebuffer();
 
-    for (int i = 0; i < len; i++) {
-        int x = x0 + i * (6 + 1);
-        SSD1322_DrawChar(x, y0, s[i]);
-    }
+    uint32_t cp;
+    for (int x = x0; (cp = SSD1322_Utf8Next(&s, NULL)) != 0; x += cur_font->advance)
+        SSD1322_DrawGlyph(x, y0, cp);
     SSD1322_RefreshFromFramebuffer();
 }
+#endif
 
 /* Offset ile kaydırmalı string çizimi (yatay scroll) */
 void SSD1322_DrawStringAtOffset(const char *s, int y, int offset)
 {
     // Sadece o satırı temizle
-    for (int row = y; row < y + 8; row++)
-        for (int col = 0; col < 128; col++)
-            if (row >= 0 && row < 64)
-                framebuf[row][col] = 0;
+    const ssd1322_surface_t *t = ssd1322_target;
+    for (int row = y; row < y + 8; row++) {
+        uint8_t *line = SSD1322_TargetRow(row);
+        if (line)
+            memset(line + t->clip_x0, 0, (size_t)(t->clip_x1 - t->clip_x0 + 1));
+    }
 
     int x = -offset;
-    for (int i = 0; s[i]; i++) {
-        SSD1322_DrawChar(x, y, s[i]);
-        x += 7; // 6px + 1 boşluk
+    uint32_t cp;
+    while ((cp = SSD1322_Utf8Next(&s, NULL)) != 0) {
+        SSD1322_DrawGlyph(x, y, cp);
+        x += cur_font->advance; // 6px + 1 boşluk
     }
 }
 
@@ -226,9 +723,7 @@ void SSD1322_DrawStringAtOffset(const char *s, int y, int offset)
 void ScrollLine_Init(scrolling_line_t *line, const char *fmt, int y)
 {
     snprintf(line->text, sizeof(line->text), fmt);
-    int len = 0;
-    for (const char *p = line->text; *p; ++p) len++;
-    line->text_pixel_width = len * 7 - 1;
+    line->text_pixel_width = SSD1322_TextWidth(line->text);
     line->offset = 0;
     line->direction = 1;
     line->y = y;
@@ -247,6 +742,7 @@ void ScrollLine_Tick(scrolling_line_t *line)
     }
 }
 
+#ifndef SSD1322_NO_FRAMEBUFFER
 /* Basit self-test (remap varyasyonları) */
 void SSD1322_SelfTestRemap(void)
 {
@@ -301,6 +797,7 @@ void SSD1322_FillTestPattern(void)
     }
     SSD1322_RefreshFromFramebuffer();
 }
+#endif
 
 
 
@@ -342,11 +839,10 @@ void SSD1322_DisplayImage(const uint8_t *img)
 /* Framebuffer'ı sıfırlamak için helper */
 void SSD1322_ClearFramebuffer(void)
 {
-    // static framebuf bu dosyada tanımlı olduğu için direkt erişebiliyoruz
-    for (int r = 0; r < 64; r++) {
-        for (int c = 0; c < 128; c++) {
-            framebuf[r][c] = 0;
-        }
+    // Aktif hedefin clip alanını sıfırlar (varsayılan: tüm framebuf)
+    const ssd1322_surface_t *t = ssd1322_target;
+    for (int r = t->clip_y0; r <= t->clip_y1; r++) {
+        memset(SSD1322_TargetRow(r) + t->clip_x0, 0, (size_t)(t->clip_x1 - t->clip_x0 + 1));
     }
 }
 
@@ -357,11 +853,14 @@ void SSD1322_ClearFramebuffer(void)
 // Tek piksel koy
 void SSD1322_SetPixel(int x, int y, uint8_t gray)
 {
-    if (x < 0 || x >= 128 || y < 0 || y >= 64) return;
-    framebuf[y][x] = gray & 0x03; // 0..3
+    const ssd1322_surface_t *t = ssd1322_target;
+    if (x < t->clip_x0 || x > t->clip_x1) return;
+    uint8_t *line = SSD1322_TargetRow(y);
+    if (line) line[x] = gray & 0x03; // 0..3
 }
 
 
+#ifndef SSD1322_NO_FRAMEBUFFER
 // Basit 16x16 aralıklarla grid testi
 void SSD1322_DrawGridTest(void)
 {
@@ -396,15 +895,27 @@ void pixel_grid_test(void)
 
     SSD1322_RefreshFromFramebuffer();
 }
+#endif
+
+// Aktif hedefte dolu dikdörtgen
+void SSD1322_FillRect(int x, int y, int w, int h, uint8_t gray)
+{
+    const ssd1322_surface_t *t = ssd1322_target;
+    int x0 = x < t->clip_x0 ? t->clip_x0 : x;
+    int x1 = x + w - 1 > t->clip_x1 ? t->clip_x1 : x + w - 1;
+    if (x0 > x1) return;
+
+    for (int r = y; r < y + h; r++) {
+        uint8_t *line = SSD1322_TargetRow(r);
+        if (line) memset(line + x0, gray & 0x03, (size_t)(x1 - x0 + 1));
+    }
+}
 
 void draw_centered_at_y(const char *s, int y)
 {
-    int len = strlen(s);
-    int total_width = len * 6 + (len + 1); // 6px karakter + 1px boşluk
-    //    int x0 = (64 - total_width) / 2;
-    int x0 = (128 - total_width) / 2;
+    int x0 = (128 - SSD1322_TextWidth(s)) / 2;
     if (x0 < 0) x0 = 0; // sığmıyorsa sola yapıştır
-    for (int i = 0; i < len; i++) {
-        SSD1322_DrawChar(x0 + i * 7, y, s[i]); // 6px + 1px boşluk
-    }
+    uint32_t cp;
+    for (int x = x0; (cp = SSD1322_Utf8Next(&s, NULL)) != 0; x += cur_font->advance)
+        SSD1322_DrawGlyph(x, y, cp);
 }
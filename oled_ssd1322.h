@@ -8,6 +8,7 @@
 
 /* STM HAL handle (dışarıda tanımlı, main.c'de) */
 #include "stm32h7xx_hal.h"
+#include "oled_font.h"
 extern SPI_HandleTypeDef hspi2;
 
 /* Kontrol pinleri */
@@ -30,15 +31,107 @@ extern SPI_HandleTypeDef hspi2;
 #define ROW_START    0x00
 #define ROW_END      0x3F
 
+/* Framebuffer boyutu ve gri seviyesi (framebuf[y][x] = 0..SSD1322_GRAY_MAX) */
+#define SSD1322_WIDTH     128
+#define SSD1322_HEIGHT    64
+#define SSD1322_GRAY_MAX  3
+
+#ifndef SSD1322_NO_FRAMEBUFFER
+extern uint8_t framebuf[SSD1322_HEIGHT][SSD1322_WIDTH];
+#endif
+
+/*
+ * Çizim hedefi. Tüm çizim fonksiyonları ssd1322_target'a yazar;
+ * varsayılan hedef framebuf'tur, band renderer kendi tamponunu bağlar.
+ * Koordinatlar hedefin koordinatıdır (framebuf / band için ekran);
+ * pix, y0. satırın başıdır. Ekran dışı yüzeyler ekrandan büyük olabilir.
+ */
+typedef struct {
+    uint8_t *pix;        // 1 byte/piksel (gri 0..SSD1322_GRAY_MAX)
+    int16_t  w, h;       // tampon boyutu
+    int16_t  stride;     // satır başına byte
+    int16_t  y0;         // tamponun ilk satırının ekrandaki y'si
+    int16_t  clip_x0, clip_y0, clip_x1, clip_y1;  // dahil, ekran koordinatı
+} ssd1322_surface_t;
+
+extern ssd1322_surface_t *ssd1322_target;
+
+/* y satırının hedef tampondaki başlangıcı, clip dışındaysa NULL */
+static inline uint8_t *SSD1322_TargetRow(int y)
+{
+    const ssd1322_surface_t *s = ssd1322_target;
+    if (y < s->clip_y0 || y > s->clip_y1) return 0;
+    return s->pix + (y - s->y0) * s->stride;
+}
+
+void SSD1322_SurfaceInit(ssd1322_surface_t *s, uint8_t *pix, int w, int h, int y0);
+void SSD1322_SetTarget(ssd1322_surface_t *s);   // NULL = framebuf
+void SSD1322_SetClip(int x0, int y0, int x1, int y1);   // hedef sınırlarıyla kesişir, dahil
+void SSD1322_ResetClip(void);
+void SSD1322_BlitSurface(int dx, int dy, const ssd1322_surface_t *src, int sx, int sy, int w, int h);
+
+
+
+
+/* Init'te yazılan kontrast değerleri */
+#define SSD1322_CONTRAST_DEFAULT         0x9F   // 0xC1 contrast current
+#define SSD1322_MASTER_CONTRAST_DEFAULT  0x0F   // 0xC7 master contrast (0..15)
+
+/*
+ * SPI hata kurtarma. Hata veren transferden sonra bağlantı arızalı sayılır,
+ * trafik kesilir; SSD1322_Recover_Poll(HAL_GetTick()) ana döngüden çağrılır,
+ * üstel backoff ile tekrar dener: komut hatasında init dizisi (remap, start
+ * line, kontrast korunur), üst üste başarısızlıkta donanım reset'i,
+ * ardından kirli bölgeler (init sonrası tüm ekran) tekrar gönderilir.
+ */
+#ifndef SSD1322_SPI_TIMEOUT_MS
+#define SSD1322_SPI_TIMEOUT_MS      10u
+#endif
+#ifndef SSD1322_RECOVER_MIN_MS
+#define SSD1322_RECOVER_MIN_MS      2u
+#endif
+#ifndef SSD1322_RECOVER_MAX_MS
+#define SSD1322_RECOVER_MAX_MS      500u
+#endif
+#ifndef SSD1322_RECOVER_HARD_AFTER
+#define SSD1322_RECOVER_HARD_AFTER  3       // başarısız yazılım init'i sonrası reset pini
+#endif
+#ifndef SSD1322_RESET_MS
+#define SSD1322_RESET_MS            2u      // reset palsi ve sonrası bekleme
+#endif
 
-
-
-/* SPI retry */
-#define SSD1322_SPI_RETRY_MAX 3
+typedef struct {
+    uint32_t tx_errors;       // hata veren transfer
+    uint32_t data_errors;     // Write RAM verisi sırasında
+    uint32_t cmd_errors;      // komut / parametre sırasında
+    uint32_t skipped;         // arıza sırasında gönderilmeyen transfer
+    uint32_t recoveries;
+    uint32_t reinits;
+    uint32_t hard_resets;
+    uint8_t  last_status;     // son HAL_StatusTypeDef hatası
+    bool     faulted;
+} ssd1322_link_stats_t;
+
+bool SSD1322_Recover_Poll(uint32_t now_ms);                // arızalıysa true
+bool SSD1322_LinkOk(void);
+/* Sürücü dışı transfer hatası (ör. DMA): data_phase = GDDRAM verisi sırasında, değilse kurtarmada init */
+void SSD1322_LinkFault(HAL_StatusTypeDef status, bool data_phase);
+void SSD1322_SetResyncCallback(void (*fn)(void *ctx), void *ctx);   // kurtarma sonrası (ör. band yeniden çizimi)
+/* GDDRAM'ı yeniden kurar: resync callback'i varsa o, yoksa framebuf'tan tam refresh */
+void SSD1322_Resync(void);
+void SSD1322_GetLinkStats(ssd1322_link_stats_t *out);
+void SSD1322_ResetLinkStats(void);
 
 /* Font / drawing */
 void SSD1322_DrawChar(int x, int y, char c);
+void SSD1322_DrawGlyph(int x, int y, uint32_t cp);        // Unicode, aktif font
+void SSD1322_DrawGlyphData(int x, int y, const ssd1322_font_t *f, const uint8_t *glyph);  // çözülmüş glif
+int  SSD1322_TextWidth(const char *s);                    // tek satır, aktif font
+void SSD1322_SetFont(const ssd1322_font_t *f);            // NULL = Font6x8_TR
+const ssd1322_font_t *SSD1322_GetFont(void);
+#ifndef SSD1322_NO_FRAMEBUFFER
 void SSD1322_DrawStringCentered(const char *s);
+#endif
 void SSD1322_DrawStringAtOffset(const char *s, int y, int offset);
 
 /* Scrolling line helper */
@@ -55,29 +148,75 @@ void ScrollLine_Tick(scrolling_line_t *line);
 
 /* Core API */
 void SSD1322_Init(void);
-void SSD1322_Clear(void);
 void SSD1322_DisplayOnOff(bool on);
+#ifndef SSD1322_NO_FRAMEBUFFER
+void SSD1322_Clear(void);
 void SSD1322_RefreshFromFramebuffer(void);
+void SSD1322_RefreshRegion(int x0, int y0, int x1, int y1);   // sadece pencereyi gönderir
+#endif
+
+/* Kirli bölge takibi (satır başına kolon aralığı) */
+void SSD1322_MarkDirty(int x0, int y0, int x1, int y1);   // dahil, ekran koordinatı
+void SSD1322_MarkAllDirty(void);
+bool SSD1322_IsDirty(void);
+#ifndef SSD1322_NO_FRAMEBUFFER
+void SSD1322_RefreshDirty(void);   // kirli satırları pencere pencere gönderir, takibi sıfırlar
+/* RefreshFromFramebuffer / RefreshDirty sonrası çağrılır (ör. oled_mirror), tek kayıt;
+   RefreshDirty kirli bölge yoksa çağırmaz */
+void SSD1322_SetPresentCallback(void (*fn)(void *ctx), void *ctx);
+/* Refresh'in satır dönüşümü: framebuf[y][x0..x0+n-1] yerine (ör. oled_layer), NULL = varsayılan */
+typedef void (*ssd1322_row_packer_t)(uint8_t *out, int y, int x0, int n);
+void SSD1322_SetRowPacker(ssd1322_row_packer_t fn);
+/* Refresh'in göndereceği GDDRAM byte'ları (aktif packer ile, kayma hariç), ör. oled_mirror */
+void SSD1322_PackRow(uint8_t *out, int y, int x0, int n);
+#endif
+/*
+ * Yatay kayma (ör. oled_orbit): x kolonu panelde x + dx'e yazılır. Refresh,
+ * band ve wire 0x15 pencereleri uygular, taşan kolonları kırpar; kirli
+ * bölgeler ve çizim framebuf koordinatında kalır. Değiştikten sonra
+ * SSD1322_Resync gerekir.
+ */
+#define SSD1322_SHIFT_MAX 8
+void SSD1322_SetShiftX(int dx);
+int  SSD1322_GetShiftX(void);
 void SSD1322_EntireDisplayOn(void);
 void SSD1322_EntireDisplayOff(void);
 
 void SSD1322_SendCommand(uint8_t cmd);
 void SSD1322_SendCommandWithData(uint8_t cmd, const uint8_t *data, uint16_t len);
+void SSD1322_DataBegin(void);                              // DC=veri, CS aktif
+void SSD1322_DataEnd(void);                                // CS pasif
+void SSD1322_WriteData(const uint8_t *data, uint16_t len);  // Write RAM (0x5C) sonrası veri
+void SSD1322_PackLine(uint8_t *out, const uint8_t *pix, int count); // gri -> GDDRAM byte'ları (2 byte/piksel)
 void SSD1322_ClearFramebuffer(void);
 void SSD1322_SetColumn(uint8_t a, uint8_t b);
-void SSD1322_SetRow(uint8_t a, uint8_t b);
-void SSD1322_DrawGridTest(void);
+void SSD1322_SetColumnOffset(uint8_t off);    // SetColumn adreslerine eklenir
+void SSD1322_SetRemap(uint8_t a, uint8_t b);  // 0xA0, kurtarmada geri yüklenir
+void SSD1322_SetRow(uint8_t a, uint8_t b);                // görünür sayfaya göre
+void SSD1322_SetRowBase(uint8_t base);        // görünür sayfanın GDDRAM satırı (0 / 64)
+uint8_t SSD1322_GetRowBase(void);
+void SSD1322_SetStartLine(uint8_t line);      // 0xA1, 0..127
+void SSD1322_SetDisplayOffset(uint8_t off);   // 0xA2, 0..127, kurtarmada geri yüklenir
+uint8_t SSD1322_GetDisplayOffset(void);
+void SSD1322_SetContrast(uint8_t c);          // 0xC1, tek komut + 1 byte
+void SSD1322_SetMasterContrast(uint8_t m);    // 0xC7, 0..15
 void SSD1322_SetPixel(int x, int y, uint8_t gray);
+void SSD1322_FillRect(int x, int y, int w, int h, uint8_t gray);
 void draw_centered_at_y(const char *s, int y);
+#ifndef SSD1322_NO_FRAMEBUFFER
+void SSD1322_DrawGridTest(void);
 void pixel_grid_test(void);
+#endif
 
 
 /* Image / logo */
 void SSD1322_DisplayImage(const uint8_t *img);
 
 /* Self-test (isteğe bağlı, remap vs denemesi) */
+#ifndef SSD1322_NO_FRAMEBUFFER
 void SSD1322_SelfTestRemap(void);
 void SSD1322_FillTestPattern(void);
+#endif
 
 /* Gerekirse logon */
 extern const uint8_t NHD_Logo[];
@@ -0,0 +1,133 @@
+/* oled_stack.c */
+
+#include <string.h>
+#include "oled_stack.h"
+
+typedef struct {
+    uint16_t w, h;            // yüzey boyutu
+    uint16_t len;             // RLE byte sayısı
+} stack_hdr_t;
+
+static uint8_t  arena[SSD1322_STACK_ARENA];
+static uint16_t level_at[SSD1322_STACK_DEPTH];   // seviyenin arena ofseti
+static uint16_t arena_used;
+static int      depth;
+
+/* Hedefin paketli byte'ları: satır başına (w + 3) / 4 byte, MSB = sol piksel */
+static int pk_stride;
+
+static uint8_t packed_get(int i)
+{
+    const ssd1322_surface_t *t = ssd1322_target;
+    const uint8_t *p = t->pix + (i / pk_stride) * t->stride;
+    int x = (i % pk_stride) * 4;
+    uint8_t b = 0;
+    for (int k = 0; k < 4; k++, x++)
+        b = (uint8_t)((b << 2) | (x < t->w ? (p[x] & 0x03) : 0));
+    return b;
+}
+
+static void packed_put(int i, uint8_t b)
+{
+    const ssd1322_surface_t *t = ssd1322_target;
+    uint8_t *p = t->pix + (i / pk_stride) * t->stride;
+    int x = (i % pk_stride) * 4;
+    for (int k = 0; k < 4 && x < t->w; k++, x++)
+        p[x] = (uint8_t)((b >> (6 - 2 * k)) & 0x03);
+}
+
+bool SSD1322_Stack_Push(void)
+{
+    const ssd1322_surface_t *t = ssd1322_target;
+    if (depth == SSD1322_STACK_DEPTH) return false;
+
+    pk_stride = (t->w + 3) / 4;
+    int n = pk_stride * t->h;
+    uint32_t start = arena_used + sizeof(stack_hdr_t);
+    uint32_t o = start;
+
+    for (int i = 0; i < n;) {
+        uint8_t b = packed_get(i);
+        int run = 1;
+        while (i + run < n && run < 130 && packed_get(i + run) == b) run++;
+
+        if (run >= 3) {
+            if (o + 2 > SSD1322_STACK_ARENA) return false;
+            arena[o++] = (uint8_t)(125 + run);
+            arena[o++] = b;
+            i += run;
+            continue;
+        }
+
+        /* literal: sıradaki 3'lü tekrara ya da 128 byte'a kadar */
+        int j = i;
+        while (j < n && j - i < 128) {
+            if (j + 2 < n) {
+                uint8_t c = packed_get(j);
+                if (packed_get(j + 1) == c && packed_get(j + 2) == c) break;
+            }
+            j++;
+        }
+        if (o + 1 + (uint32_t)(j - i) > SSD1322_STACK_ARENA) return false;
+        arena[o++] = (uint8_t)(j - i - 1);
+        for (; i < j; i++) arena[o++] = packed_get(i);
+    }
+
+    stack_hdr_t hdr = { (uint16_t)t->w, (uint16_t)t->h, (uint16_t)(o - start) };
+    memcpy(&arena[arena_used], &hdr, sizeof(hdr));
+    level_at[depth++] = arena_used;
+    arena_used = (uint16_t)((o + 3u) & ~3u);
+    if (arena_used > SSD1322_STACK_ARENA) arena_used = SSD1322_STACK_ARENA;
+    return true;
+}
+
+bool SSD1322_Stack_Pop(void)
+{
+    const ssd1322_surface_t *t = ssd1322_target;
+    if (!depth) return false;
+
+    stack_hdr_t hdr;
+    memcpy(&hdr, &arena[level_at[depth - 1]], sizeof(hdr));
+    if (hdr.w != t->w || hdr.h != t->h) return false;
+
+    pk_stride = (t->w + 3) / 4;
+    const uint8_t *p = &arena[level_at[depth - 1] + sizeof(hdr)];
+    const uint8_t *end = p + hdr.len;
+    int i = 0;
+    while (p < end) {
+        uint8_t c = *p++;
+        if (c < 0x80) {
+            for (int k = 0; k <= c; k++) packed_put(i++, *p++);
+        } else {
+            uint8_t b = *p++;
+            for (int k = 0; k < c - 125; k++) packed_put(i++, b);
+        }
+    }
+
+    SSD1322_MarkDirty(0, t->y0, t->w - 1, t->y0 + t->h - 1);
+    SSD1322_Stack_Drop();
+    return true;
+}
+
+void SSD1322_Stack_Drop(void)
+{
+    if (!depth) return;
+    arena_used = level_at[--depth];
+}
+
+int SSD1322_Stack_Depth(void)
+{
+    return depth;
+}
+
+size_t SSD1322_Stack_Bytes(int level)
+{
+    if (level < 0 || level >= depth) return 0;
+    uint16_t end = level + 1 < depth ? level_at[level + 1] : arena_used;
+    return (size_t)(end - level_at[level]);
+}
+
+size_t SSD1322_Stack_Free(void)
+{
+    return SSD1322_STACK_ARENA - arena_used;
+}
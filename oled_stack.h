@@ -0,0 +1,43 @@
+/* oled_stack.h */
+
+#ifndef OLED_STACK_H
+#define OLED_STACK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "oled_ssd1322.h"
+
+/*
+ * Sıkıştırılmış ekran yığını. Push aktif hedefin (varsayılan framebuf)
+ * içeriğini 2bpp paketleyip RLE ile sabit bir arena'ya yazar, Pop aynı
+ * boyuttaki hedefe geri açar: üst menü yeniden çizilmez.
+ *
+ * RLE (PackBits benzeri, paketli byte'lar üzerinde):
+ *   0x00..0x7F  n+1 literal byte
+ *   0x80..0xFF  sıradaki byte n-125 kez (3..130)
+ *
+ * Arena bir yığın gibi kullanılır: sadece en üstteki seviye serbest kalır.
+ */
+#ifndef SSD1322_STACK_ARENA
+#define SSD1322_STACK_ARENA 4096u
+#endif
+
+#ifndef SSD1322_STACK_DEPTH
+#define SSD1322_STACK_DEPTH 8
+#endif
+
+/* Yer yoksa false, arena değişmez */
+bool SSD1322_Stack_Push(void);
+
+/* En üst seviyeyi hedefe açar ve kirli işaretler; boşsa ya da boyut farklıysa false */
+bool SSD1322_Stack_Pop(void);
+
+/* En üst seviyeyi açmadan atar */
+void SSD1322_Stack_Drop(void);
+
+int    SSD1322_Stack_Depth(void);
+size_t SSD1322_Stack_Bytes(int level);   // seviyenin arena'da tuttuğu byte (başlık dahil)
+size_t SSD1322_Stack_Free(void);
+
+#endif /* OLED_STACK_H */
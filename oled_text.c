@@ -0,0 +1,197 @@
+/* oled_text.c */
+
+#include "oled_text.h"
+
+enum { END_TEXT, END_NEWLINE, END_WRAP, END_FULL };
+
+static const uint8_t *lookup(const ssd1322_font_t *f, uint32_t cp)
+{
+    const uint8_t *g = SSD1322_FontGlyph(f, cp);
+    return g ? g : SSD1322_FontGlyph(f, f->fallback);
+}
+
+/* Satır sonuna "..." (font'ta varsa U+2026): sığana kadar sondan glif silinir */
+static void line_ellipsis(ssd1322_text_t *t, ssd1322_text_line_t *ln)
+{
+    const ssd1322_font_t *f = t->font;
+    const uint8_t *space = SSD1322_FontGlyph(f, ' ');
+    const uint8_t *dot = SSD1322_FontGlyph(f, 0x2026);
+    int k = 1;
+    if (!dot) {
+        dot = SSD1322_FontGlyph(f, '.');
+        k = 3;
+    }
+
+    int n = ln->count;
+    while (n > 0 && (SSD1322_FontTextWidth(f, n + k) > t->w || ln->first + n + k > SSD1322_TEXT_MAX_GLYPHS))
+        n--;
+    while (n > 0 && t->glyph[ln->first + n - 1] == space) n--;
+    if (ln->first + n + k > SSD1322_TEXT_MAX_GLYPHS) k = SSD1322_TEXT_MAX_GLYPHS - ln->first - n;
+
+    for (int i = 0; i < k; i++) t->glyph[ln->first + n + i] = dot;
+    ln->count = (uint16_t)(n + k);
+}
+
+/* Kaydırmada satır başındaki boşlukları atla */
+static const char *skip_spaces(const char *s)
+{
+    while (*s == ' ') s++;
+    return s;
+}
+
+void SSD1322_Text_Init(ssd1322_text_t *t, const char *s, int x, int y, int w, int h, uint8_t flags)
+{
+    t->text = s;
+    t->font = SSD1322_GetFont();
+    t->x = (int16_t)x;
+    t->y = (int16_t)y;
+    t->w = (int16_t)w;
+    t->h = (int16_t)h;
+    t->flags = flags;
+    t->valid = false;
+}
+
+void SSD1322_Text_Set(ssd1322_text_t *t, const char *s)
+{
+    t->text = s;
+    t->valid = false;
+}
+
+void SSD1322_Text_SetFont(ssd1322_text_t *t, const ssd1322_font_t *f)
+{
+    t->font = f ? f : &Font6x8_TR;
+    t->valid = false;
+}
+
+void SSD1322_Text_Move(ssd1322_text_t *t, int x, int y)
+{
+    int dx = x - t->x, dy = y - t->y;
+    t->x = (int16_t)x;
+    t->y = (int16_t)y;
+    if (!t->valid) return;
+    for (int i = 0; i < t->n_lines; i++) {
+        t->line[i].x = (int16_t)(t->line[i].x + dx);
+        t->line[i].y = (int16_t)(t->line[i].y + dy);
+    }
+}
+
+void SSD1322_Text_Invalidate(ssd1322_text_t *t)
+{
+    t->valid = false;
+}
+
+void SSD1322_Text_Layout(ssd1322_text_t *t)
+{
+    if (t->valid) return;
+
+    const ssd1322_font_t *f = t->font;
+    const uint8_t *space = SSD1322_FontGlyph(f, ' ');
+    bool wrap = (t->flags & SSD1322_TEXT_WRAP) != 0;
+    int pitch = f->h + SSD1322_TEXT_LINE_GAP;
+
+    int max_lines = SSD1322_TEXT_MAX_LINES;
+    if (t->h > 0 && (t->h + SSD1322_TEXT_LINE_GAP) / pitch < max_lines)
+        max_lines = (t->h + SSD1322_TEXT_LINE_GAP) / pitch;
+    if (max_lines < 1) max_lines = 1;
+
+    const char *s = t->text ? t->text : "";
+    int ng = 0, nl = 0;
+    t->truncated = false;
+
+    while (nl < max_lines) {
+        ssd1322_text_line_t *ln = &t->line[nl++];
+        int n = 0, brk = -1, end;
+        const char *brk_src = 0;
+        ln->first = (uint16_t)ng;
+
+        for (;;) {
+            const char *prev = s;
+            uint32_t cp = SSD1322_Utf8Next(&s, 0);
+            if (cp == 0)    { s = prev; end = END_TEXT; break; }
+            if (cp == '\n') { end = END_NEWLINE; break; }
+
+            if (wrap && SSD1322_FontTextWidth(f, n + 1) > t->w) {
+                end = END_WRAP;
+                if (cp == ' ') break;                             // boşlukta kır
+                if (brk >= 0) { n = brk; s = brk_src; break; }    // son kelime alt satıra
+                if (n > 0) { s = prev; break; }                   // tek kelime sığmıyor: harften kır
+            }
+            if (ng == SSD1322_TEXT_MAX_GLYPHS) { s = prev; end = END_FULL; break; }
+
+            if (cp == ' ') { brk = n; brk_src = s; }
+            t->glyph[ng++] = lookup(f, cp);
+            n++;
+        }
+
+        if (end == END_WRAP) {
+            while (n > 0 && t->glyph[ln->first + n - 1] == space) n--;
+            s = skip_spaces(s);
+        }
+        ln->count = (uint16_t)n;
+        ng = ln->first + n;
+
+        if (!wrap && (t->flags & SSD1322_TEXT_ELLIPSIS) && SSD1322_FontTextWidth(f, n) > t->w) {
+            line_ellipsis(t, ln);
+            ng = ln->first + ln->count;
+        }
+
+        if (end == END_TEXT || (end == END_WRAP && !*s)) break;
+        if (end == END_FULL || (nl == max_lines && *s)) {
+            t->truncated = true;
+            break;
+        }
+    }
+
+    if (t->truncated && (t->flags & SSD1322_TEXT_ELLIPSIS))
+        line_ellipsis(t, &t->line[nl - 1]);
+
+    /* hizalama */
+    int height = nl * pitch - SSD1322_TEXT_LINE_GAP;
+    int y = t->y;
+    if ((t->flags & SSD1322_TEXT_VCENTER) && t->h > height) y += (t->h - height) / 2;
+
+    t->width = 0;
+    for (int i = 0; i < nl; i++) {
+        ssd1322_text_line_t *ln = &t->line[i];
+        int w = SSD1322_FontTextWidth(f, ln->count);
+        int x = t->x;
+        switch (t->flags & SSD1322_TEXT_ALIGN_MASK) {
+            case SSD1322_TEXT_CENTER: x += (t->w - w) / 2; break;
+            case SSD1322_TEXT_RIGHT:  x += t->w - w;       break;
+            default: break;
+        }
+        ln->x = (int16_t)x;
+        ln->y = (int16_t)(y + i * pitch);
+        ln->width = (int16_t)w;
+        if (w > t->width) t->width = (int16_t)w;
+    }
+    t->n_lines = (uint8_t)nl;
+    t->height = (int16_t)height;
+    t->valid = true;
+}
+
+void SSD1322_Text_Draw(ssd1322_text_t *t)
+{
+    SSD1322_Text_Layout(t);
+
+    const ssd1322_font_t *f = t->font;
+    for (int i = 0; i < t->n_lines; i++) {
+        const ssd1322_text_line_t *ln = &t->line[i];
+        const uint8_t *const *g = &t->glyph[ln->first];
+        int x = ln->x;
+        for (int k = 0; k < ln->count; k++, x += f->advance) {
+            if (g[k]) SSD1322_DrawGlyphData(x, ln->y, f, g[k]);
+        }
+    }
+}
+
+void SSD1322_Text_MarkDirty(ssd1322_text_t *t)
+{
+    SSD1322_Text_Layout(t);
+
+    for (int i = 0; i < t->n_lines; i++) {
+        const ssd1322_text_line_t *ln = &t->line[i];
+        if (ln->width > 0)
+            SSD1322_MarkDirty(ln->x, ln->y, ln->x + ln->width - 1, ln->y + t->font->h - 1);
+    }
+}
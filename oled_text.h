@@ -0,0 +1,75 @@
+/* oled_text.h */
+
+#ifndef OLED_TEXT_H
+#define OLED_TEXT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oled_ssd1322.h"
+
+/*
+ * Metin yerleşimi. Bir ssd1322_text_t handle'ı metni bir kutuya bir kez
+ * yerleştirir: UTF-8 çözümü, font araması, kelime kaydırma, hizalama ve
+ * "..." kesmesi Layout'ta yapılır, sonuç glif dizileri (satır başına run)
+ * olarak handle'da saklanır. Draw sadece bu glifleri blitler.
+ *
+ * Metin kopyalanmaz; içerik değişirse SSD1322_Text_Set ya da
+ * SSD1322_Text_Invalidate çağrılmalı.
+ */
+
+#ifndef SSD1322_TEXT_MAX_GLYPHS
+#define SSD1322_TEXT_MAX_GLYPHS 160
+#endif
+
+#ifndef SSD1322_TEXT_MAX_LINES
+#define SSD1322_TEXT_MAX_LINES  8
+#endif
+
+#ifndef SSD1322_TEXT_LINE_GAP
+#define SSD1322_TEXT_LINE_GAP   1    // satırlar arası boş piksel
+#endif
+
+/* flags */
+#define SSD1322_TEXT_LEFT       0x00
+#define SSD1322_TEXT_CENTER     0x01
+#define SSD1322_TEXT_RIGHT      0x02
+#define SSD1322_TEXT_ALIGN_MASK 0x03
+#define SSD1322_TEXT_VCENTER    0x04   // kutuda dikey ortala (h > 0)
+#define SSD1322_TEXT_WRAP       0x08   // kelime kaydırma, yoksa sadece '\n'
+#define SSD1322_TEXT_ELLIPSIS   0x10   // sığmayan satır/metin "..." ile biter
+
+typedef struct {
+    int16_t  x, y;          // ekran koordinatı
+    int16_t  width;         // piksel
+    uint16_t first, count;  // glyph[] içindeki run
+} ssd1322_text_line_t;
+
+typedef struct {
+    const char *text;
+    const ssd1322_font_t *font;
+    int16_t x, y, w, h;     // kutu; h <= 0 = yükseklik sınırı yok
+    uint8_t flags;
+
+    /* Layout sonucu */
+    bool    valid;
+    bool    truncated;      // metnin tamamı sığmadı
+    uint8_t n_lines;
+    int16_t width, height;  // kaplanan alan (piksel)
+    ssd1322_text_line_t line[SSD1322_TEXT_MAX_LINES];
+    const uint8_t *glyph[SSD1322_TEXT_MAX_GLYPHS];   // NULL = çizilecek glif yok
+} ssd1322_text_t;
+
+/* Font, Init anındaki aktif font olur */
+void SSD1322_Text_Init(ssd1322_text_t *t, const char *s, int x, int y, int w, int h, uint8_t flags);
+void SSD1322_Text_Set(ssd1322_text_t *t, const char *s);
+void SSD1322_Text_SetFont(ssd1322_text_t *t, const ssd1322_font_t *f);
+void SSD1322_Text_Move(ssd1322_text_t *t, int x, int y);   // yerleşim korunur, sadece kaydırılır
+void SSD1322_Text_Invalidate(ssd1322_text_t *t);
+
+void SSD1322_Text_Layout(ssd1322_text_t *t);   // geçerliyse bir şey yapmaz
+void SSD1322_Text_Draw(ssd1322_text_t *t);     // gerekirse Layout, sonra blit (refresh yapmaz)
+
+/* Yazılan alanı kirli işaretle (RefreshDirty için) */
+void SSD1322_Text_MarkDirty(ssd1322_text_t *t);
+
+#endif /* OLED_TEXT_H */
@@ -0,0 +1,174 @@
+/* oled_transition.c */
+
+#include <string.h>
+#include "oled_transition.h"
+
+#ifndef SSD1322_NO_FRAMEBUFFER
+
+static const uint8_t (*tr_to)[SSD1322_WIDTH];   // NULL = geçiş yok
+static uint8_t  tr_type;
+static uint32_t tr_ms, tr_start;
+static bool     tr_started;
+static int      tr_pos;                          // gönderilmiş ilerleme (piksel)
+static uint32_t tr_errors;                       // başlangıçtaki tx_errors: değiştiyse parçalar kayıp
+
+static bool is_vertical(uint8_t type)
+{
+    return type == SSD1322_TRANSITION_PUSH_UP || type == SSD1322_TRANSITION_PUSH_DOWN ||
+           type == SSD1322_TRANSITION_WIPE_UP || type == SSD1322_TRANSITION_WIPE_DOWN;
+}
+
+/* o ilerlemesinde (x, y) pikseli */
+static uint8_t compose(int x, int y, int o)
+{
+    const int W = SSD1322_WIDTH, H = SSD1322_HEIGHT;
+    switch (tr_type) {
+        case SSD1322_TRANSITION_PUSH_LEFT:   return x + o < W ? framebuf[y][x + o] : tr_to[y][x + o - W];
+        case SSD1322_TRANSITION_PUSH_RIGHT:  return x >= o ? framebuf[y][x - o] : tr_to[y][x - o + W];
+        case SSD1322_TRANSITION_COVER_LEFT:  return x >= W - o ? tr_to[y][x - (W - o)] : framebuf[y][x];
+        case SSD1322_TRANSITION_COVER_RIGHT: return x < o ? tr_to[y][x + W - o] : framebuf[y][x];
+        case SSD1322_TRANSITION_WIPE_LEFT:   return x >= W - o ? tr_to[y][x] : framebuf[y][x];
+        case SSD1322_TRANSITION_WIPE_RIGHT:  return x < o ? tr_to[y][x] : framebuf[y][x];
+        case SSD1322_TRANSITION_WIPE_UP:     return y >= H - o ? tr_to[y][x] : framebuf[y][x];
+        case SSD1322_TRANSITION_WIPE_DOWN:   return y < o ? tr_to[y][x] : framebuf[y][x];
+        default:                             return tr_to[y][x];
+    }
+}
+
+/* Pencereyi o ilerlemesiyle satır satır birleştirip gönderir */
+static void send_window(int x0, int y0, int x1, int y1, int o)
+{
+    uint8_t pix[SSD1322_WIDTH];
+    uint8_t linebuf[SSD1322_WIDTH * 2];
+    int dx = SSD1322_GetShiftX();
+
+    /* yatay kayma: panelden taşan kolonlar atlanır */
+    if (x0 + dx < 0) x0 = -dx;
+    if (x1 + dx > SSD1322_WIDTH - 1) x1 = SSD1322_WIDTH - 1 - dx;
+    if (x0 > x1) return;
+    int n = x1 - x0 + 1;
+
+    SSD1322_SetColumn((uint8_t)(COLUMN_START + x0 + dx), (uint8_t)(COLUMN_START + x1 + dx));
+    SSD1322_SetRow((uint8_t)(ROW_START + y0), (uint8_t)(ROW_START + y1));
+    SSD1322_SendCommand(0x5C); // Write RAM
+
+    for (int y = y0; y <= y1; y++) {
+        for (int x = x0; x <= x1; x++) pix[x - x0] = compose(x, y, o);
+        SSD1322_PackLine(linebuf, pix, n);
+        SSD1322_WriteData(linebuf, (uint16_t)(n * 2));
+    }
+}
+
+/* p -> o adımında değişen bölgeyi gönderir */
+static void step(int p, int o)
+{
+    const int W = SSD1322_WIDTH, H = SSD1322_HEIGHT;
+    uint8_t base = SSD1322_GetRowBase();
+
+    switch (tr_type) {
+        case SSD1322_TRANSITION_PUSH_UP:
+            SSD1322_SetStartLine((uint8_t)(base + o));
+            break;
+        case SSD1322_TRANSITION_PUSH_DOWN:
+            SSD1322_SetStartLine((uint8_t)(base - o));
+            break;
+        case SSD1322_TRANSITION_PUSH_LEFT:
+        case SSD1322_TRANSITION_PUSH_RIGHT:
+            send_window(0, 0, W - 1, H - 1, o);
+            break;
+        case SSD1322_TRANSITION_COVER_LEFT:  send_window(W - o, 0, W - 1, H - 1, o); break;
+        case SSD1322_TRANSITION_COVER_RIGHT: send_window(0, 0, o - 1, H - 1, o);     break;
+        case SSD1322_TRANSITION_WIPE_LEFT:   send_window(W - o, 0, W - 1 - p, H - 1, o); break;
+        case SSD1322_TRANSITION_WIPE_RIGHT:  send_window(p, 0, o - 1, H - 1, o);         break;
+        case SSD1322_TRANSITION_WIPE_UP:     send_window(0, H - o, W - 1, H - 1 - p, o); break;
+        case SSD1322_TRANSITION_WIPE_DOWN:   send_window(0, p, W - 1, o - 1, o);         break;
+        default: break;
+    }
+}
+
+static uint32_t link_errors(void)
+{
+    ssd1322_link_stats_t st;
+    SSD1322_GetLinkStats(&st);
+    return st.tx_errors;
+}
+
+/* Yumuşak başlangıç/bitiş (smoothstep), 0..span */
+static int eased(uint32_t el, uint32_t ms, int span)
+{
+    int64_t t = ((int64_t)el << 10) / ms;                    // 0..1024
+    int64_t e = (t * t * (3 * 1024 - 2 * t)) >> 20;          // 0..1024
+    return (int)((e * span) >> 10);
+}
+
+void SSD1322_Transition_Start(const uint8_t (*to)[SSD1322_WIDTH], uint8_t type, uint32_t ms)
+{
+    tr_to = to;
+    tr_type = type;
+    tr_ms = ms ? ms : 1;
+    tr_started = false;
+    tr_pos = 0;
+    tr_errors = link_errors();
+
+    if (type == SSD1322_TRANSITION_PUSH_UP || type == SSD1322_TRANSITION_PUSH_DOWN) {
+        /* yeni ekran görünmeyen sayfaya (görünür sayfaya göre +64) */
+        uint8_t linebuf[SSD1322_WIDTH * 2];
+        int dx = SSD1322_GetShiftX();
+        int src = dx < 0 ? -dx : 0, dst = dx > 0 ? dx : 0;
+        memset(linebuf, 0, sizeof(linebuf));   // kaymada açılan kolonlar
+        SSD1322_SetColumn(COLUMN_START, COLUMN_END);
+        SSD1322_SetRow(ROW_START + SSD1322_HEIGHT, ROW_END + SSD1322_HEIGHT);
+        SSD1322_SendCommand(0x5C); // Write RAM
+        for (int y = 0; y < SSD1322_HEIGHT; y++) {
+            SSD1322_PackLine(linebuf + dst * 2, to[y] + src, SSD1322_WIDTH - src - dst);
+            SSD1322_WriteData(linebuf, sizeof(linebuf));
+        }
+    }
+}
+
+bool SSD1322_Transition_Active(void)
+{
+    return tr_to != 0;
+}
+
+bool SSD1322_Transition_Tick(uint32_t now_ms)
+{
+    if (!tr_to) return false;
+    if (!tr_started) {
+        tr_started = true;
+        tr_start = now_ms;
+    }
+
+    int span = is_vertical(tr_type) ? SSD1322_HEIGHT : SSD1322_WIDTH;
+    uint32_t el = now_ms - tr_start;
+    int o = el >= tr_ms ? span : eased(el, tr_ms, span);
+
+    if (o != tr_pos) {
+        step(tr_pos, o);
+        tr_pos = o;
+    }
+    if (o < span) return true;
+
+    /* bitti: donanım geçişinde görünür sayfa değişti */
+    if (tr_type == SSD1322_TRANSITION_PUSH_UP || tr_type == SSD1322_TRANSITION_PUSH_DOWN)
+        SSD1322_SetRowBase((uint8_t)(SSD1322_GetRowBase() + SSD1322_HEIGHT));
+    memcpy(framebuf, tr_to, sizeof(framebuf));
+    tr_to = 0;
+    if (link_errors() != tr_errors) {
+        /* arada arıza (kurtarılmış olsa da): kaybolan adımlar ve görünmeyen sayfa
+           tekrar gönderilmez, tüm ekran; arıza sürüyorsa kurtarma gönderir */
+        SSD1322_MarkAllDirty();
+        if (SSD1322_LinkOk()) SSD1322_RefreshDirty();
+    }
+    return false;
+}
+
+void SSD1322_Transition_Run(const uint8_t (*to)[SSD1322_WIDTH], uint8_t type, uint32_t ms)
+{
+    SSD1322_Transition_Start(to, type, ms);
+    while (SSD1322_Transition_Tick(HAL_GetTick())) {
+        HAL_Delay(1);
+    }
+}
+
+#endif /* SSD1322_NO_FRAMEBUFFER */
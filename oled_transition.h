@@ -0,0 +1,51 @@
+/* oled_transition.h */
+
+#ifndef OLED_TRANSITION_H
+#define OLED_TRANSITION_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oled_ssd1322.h"
+
+/*
+ * Ekran geçişleri: framebuf'taki (ekrandaki) görüntüden yeni bir ekrana.
+ *
+ * PUSH_UP / PUSH_DOWN donanımla yapılır: yeni ekran GDDRAM'ın görünmeyen
+ * 64 satırına bir kez yazılır, sonra her adımda sadece start line (0xA1)
+ * komutu gider. Geçiş sonunda görünür sayfa değişir (SSD1322_SetRowBase).
+ *
+ * Yatay geçişler ve wipe'lar satır satır birleştirilir; her adımda sadece
+ * değişen pencere (wipe'ta yeni açılan şerit) gönderilir.
+ *
+ * Geçiş bitince yeni ekran framebuf'a kopyalanır. Geçiş sürerken framebuf
+ * eski ekran olarak okunur, değiştirilmemelidir. Geçiş sırasında bağlantı
+ * arızalanırsa bitişte tüm ekran kirli işaretlenip yeniden gönderilir.
+ */
+#ifndef SSD1322_NO_FRAMEBUFFER
+
+enum {
+    SSD1322_TRANSITION_PUSH_LEFT,     // ikisi birlikte sola kayar
+    SSD1322_TRANSITION_PUSH_RIGHT,
+    SSD1322_TRANSITION_PUSH_UP,       // donanım (start line)
+    SSD1322_TRANSITION_PUSH_DOWN,     // donanım (start line)
+    SSD1322_TRANSITION_COVER_LEFT,    // yeni ekran sağdan eskinin üstüne gelir
+    SSD1322_TRANSITION_COVER_RIGHT,
+    SSD1322_TRANSITION_WIPE_LEFT,     // sınır sağdan sola ilerler, yeni ekran yerinde açılır
+    SSD1322_TRANSITION_WIPE_RIGHT,
+    SSD1322_TRANSITION_WIPE_UP,
+    SSD1322_TRANSITION_WIPE_DOWN,
+};
+
+/* to: framebuf düzeninde yeni ekran, geçiş bitene kadar geçerli kalmalı */
+void SSD1322_Transition_Start(const uint8_t (*to)[SSD1322_WIDTH], uint8_t type, uint32_t ms);
+
+/* SSD1322_Transition_Tick(HAL_GetTick()) ana döngüden; sürüyorsa true */
+bool SSD1322_Transition_Tick(uint32_t now_ms);
+bool SSD1322_Transition_Active(void);
+
+/* Bloklayan geçiş */
+void SSD1322_Transition_Run(const uint8_t (*to)[SSD1322_WIDTH], uint8_t type, uint32_t ms);
+
+#endif /* SSD1322_NO_FRAMEBUFFER */
+
+#endif /* OLED_TRANSITION_H */
@@ -0,0 +1,116 @@
+/* oled_wire.c */
+
+#include <stddef.h>
+#include "oled_wire.h"
+
+static const uint8_t *wire_p;          // sıradaki kayıt, NULL = boşta
+#ifdef SSD1322_USE_DMA
+static bool wire_dma_active;
+#endif
+
+/* Yatay kaymada panelden taşan kolonlar: satır başına byte aralığı [clip_l, clip_r) */
+static bool     wire_clip;
+static uint16_t wire_row, wire_clip_l, wire_clip_r;
+static uint16_t wire_x;                // satır içindeki byte konumu
+
+void SSD1322_Wire_Start(const uint8_t *stream)
+{
+    wire_p = stream;
+    wire_clip = false;
+#ifdef SSD1322_USE_DMA
+    wire_dma_active = false;
+#endif
+}
+
+/* 0x15 penceresine kaymayı ekler, panel dışına düşen kolonları kırpar */
+static void wire_set_column(uint8_t a, uint8_t b)
+{
+    int dx = SSD1322_GetShiftX(), lo = a + dx, hi = b + dx;
+    int l = lo < COLUMN_START ? COLUMN_START - lo : 0;
+    int r = hi > COLUMN_END ? hi - COLUMN_END : 0;
+
+    wire_x = 0;
+    if (b < a) { wire_clip = false; SSD1322_SetColumn(a, b); return; }
+    wire_clip = l || r;
+    wire_row = (uint16_t)((b - a + 1) * 2);
+    wire_clip_l = (uint16_t)(l * 2);
+    wire_clip_r = (uint16_t)(wire_row > r * 2 ? wire_row - r * 2 : 0);
+    if (lo + l <= hi - r) SSD1322_SetColumn((uint8_t)(lo + l), (uint8_t)(hi - r));
+}
+
+static void wire_write_clipped(const uint8_t *d, uint16_t len)
+{
+    while (len) {
+        uint16_t n = (uint16_t)(wire_row - wire_x);
+        if (n > len) n = len;
+        uint16_t s = wire_x < wire_clip_l ? wire_clip_l : wire_x;
+        uint16_t e = wire_x + n < wire_clip_r ? (uint16_t)(wire_x + n) : wire_clip_r;
+        if (s < e) SSD1322_WriteData(d + (s - wire_x), (uint16_t)(e - s));
+        wire_x = (uint16_t)((wire_x + n) % wire_row);
+        d += n;
+        len = (uint16_t)(len - n);
+    }
+}
+
+bool SSD1322_Wire_Poll(void)
+{
+#ifdef SSD1322_USE_DMA
+    if (wire_dma_active) {
+        if (HAL_SPI_GetState(&hspi2) != HAL_SPI_STATE_READY) return true;
+        wire_dma_active = false;
+        SSD1322_DataEnd();
+        if (HAL_SPI_GetError(&hspi2) != HAL_SPI_ERROR_NONE)
+            SSD1322_LinkFault(HAL_ERROR, true);    // transfer hatası: akış aşağıda kesilir
+    }
+#endif
+
+    while (wire_p) {
+        const uint8_t *p = wire_p;
+        if (!SSD1322_LinkOk()) {   // bağlantı arızalı: akış yarıda kalır, resync sonrası tekrar gönderilmeli
+            wire_p = NULL;
+            break;
+        }
+
+        switch (p[0]) {
+            case SSD1322_WIRE_CMD: {
+                uint8_t n = p[1];
+                if (n == 3 && p[2] == 0x75)      SSD1322_SetRow(p[3], p[4]);      // görünür sayfaya göre
+                else if (n == 3 && p[2] == 0x15) wire_set_column(p[3], p[4]);     // kolon ofseti + kayma
+                else if (n) SSD1322_SendCommandWithData(p[2], p + 3, (uint16_t)(n - 1));
+                if (n && p[2] != 0x15) wire_x = 0;                                // yeni pencere / Write RAM
+                wire_p = p + 2 + n;
+                break;
+            }
+            case SSD1322_WIRE_DATA: {
+                uint16_t len = (uint16_t)(p[1] | (p[2] << 8));
+                const uint8_t *data = p + 3;
+                wire_p = data + len;
+                if (wire_clip) {
+                    wire_write_clipped(data, len);
+                    break;
+                }
+#ifdef SSD1322_USE_DMA
+                SSD1322_DataBegin();
+                if (HAL_SPI_Transmit_DMA(&hspi2, (uint8_t *)data, len) == HAL_OK) {
+                    wire_dma_active = true;
+                    return true;   // CPU serbest, bitişi sonraki Poll görür
+                }
+                SSD1322_DataEnd();   // DMA başlamadı: bloklayan gönderim, hatası LinkFault'a gider
+#endif
+                SSD1322_WriteData(data, len);
+                break;
+            }
+            case SSD1322_WIRE_END:
+            default:
+                wire_p = NULL;
+                break;
+        }
+    }
+    return false;
+}
+
+void SSD1322_SendWireStream(const uint8_t *stream)
+{
+    SSD1322_Wire_Start(stream);
+    while (SSD1322_Wire_Poll()) { }
+}
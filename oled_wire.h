@@ -0,0 +1,38 @@
+/* oled_wire.h */
+
+#ifndef OLED_WIRE_H
+#define OLED_WIRE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "oled_ssd1322.h"
+
+/*
+ * Önceden kodlanmış ekran akışı (tools/ssd1322_bake ile üretilir).
+ * SSD1322'nin beklediği byte dizisi olduğu gibi flash'ta durur:
+ *
+ *   0x01 n  cmd d1..d(n-1)     komut + veri (n >= 1)
+ *   0x02 lo hi  payload[len]   GDDRAM verisi (0x5C sonrası)
+ *   0x00                       son
+ *
+ * Gönderimde dönüşüm yapılmaz (pencere komutları 0x15/0x75 hariç: kolon
+ * ofseti, yatay kayma ve görünür sayfa eklenir), framebuf'a dokunulmaz.
+ * Kaymada panelden taşan kolonların verisi atlanır.
+ * SSD1322_USE_DMA ile DATA kayıtları DMA ile flash'tan doğrudan gider
+ * (kırpılan pencerelerde satır satır, DMA'sız).
+ */
+#define SSD1322_WIRE_END   0x00
+#define SSD1322_WIRE_CMD   0x01
+#define SSD1322_WIRE_DATA  0x02
+
+/* Bloklayan gönderim */
+void SSD1322_SendWireStream(const uint8_t *stream);
+
+/* Bloklamayan: Start sonrası Poll, false dönene kadar ana döngüden çağrılır */
+void SSD1322_Wire_Start(const uint8_t *stream);
+bool SSD1322_Wire_Poll(void);
+
+/* Açılış logosu, önceden kodlanmış (oled_images_wire.c) */
+extern const uint8_t NHD_Logo_Wire[];
+
+#endif /* OLED_WIRE_H */
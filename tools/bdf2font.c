@@ -0,0 +1,204 @@
+/* tools/bdf2font.c - BDF fontu ssd1322_font_t C kaynağına çevirir (PC aracı)
+ *
+ * Derleme:  gcc -O2 -o bdf2font tools/bdf2font.c
+ * Kullanım: bdf2font [-n isim] [-r aralıklar] [-w W] [-h H] [-a adım] [-f yedek] font.bdf > cikti.c
+ *   -r:  kod noktası aralıkları, ör. "0x20-0x7E,0xA0-0x17F" (varsayılan 0x20-0x17F)
+ *   -w/-h: glif hücresi (varsayılan FONTBOUNDINGBOX, h <= 16)
+ *   -a:  karakter adımı (varsayılan w + 1)
+ *   -f:  olmayan kod noktası yerine çizilecek glif (varsayılan '?')
+ *
+ * Çıktı oled_font.h'deki formattadır: 128'lik bloklar, blok başına varlık
+ * bitmap'i + rank ve kod noktası sırasıyla glifler (kolon kolon, LSB = üst satır).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define MAX_CP     0x10000
+#define MAX_RANGES 32
+
+typedef struct {
+    uint8_t *bits;      /* w * col_bytes, NULL = yok */
+} glyph_t;
+
+static glyph_t glyphs[MAX_CP];
+static uint32_t range_lo[MAX_RANGES], range_hi[MAX_RANGES];
+static int n_ranges;
+
+static void die(const char *msg)
+{
+    fprintf(stderr, "bdf2font: %s\n", msg);
+    exit(1);
+}
+
+static int in_ranges(uint32_t cp)
+{
+    for (int i = 0; i < n_ranges; i++)
+        if (cp >= range_lo[i] && cp <= range_hi[i]) return 1;
+    return 0;
+}
+
+static void parse_ranges(const char *s)
+{
+    n_ranges = 0;
+    while (*s) {
+        char *end;
+        if (n_ranges == MAX_RANGES) die("çok fazla aralık");
+        range_lo[n_ranges] = (uint32_t)strtoul(s, &end, 0);
+        range_hi[n_ranges] = range_lo[n_ranges];
+        if (*end == '-') range_hi[n_ranges] = (uint32_t)strtoul(end + 1, &end, 0);
+        if (end == s || range_hi[n_ranges] >= MAX_CP || range_hi[n_ranges] < range_lo[n_ranges])
+            die("bozuk aralık");
+        n_ranges++;
+        s = end;
+        if (*s == ',') s++;
+    }
+}
+
+static int starts(const char *line, const char *key)
+{
+    size_t n = strlen(key);
+    return !strncmp(line, key, n) && (line[n] == ' ' || line[n] == '\r' || line[n] == '\n' || !line[n]);
+}
+
+int main(int argc, char **argv)
+{
+    const char *name = "Font_Custom", *path = NULL;
+    int cw = 0, ch = 0, adv = 0;
+    uint32_t fallback = '?';
+
+    parse_ranges("0x20-0x17F");
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc)      name = argv[++i];
+        else if (!strcmp(argv[i], "-r") && i + 1 < argc) parse_ranges(argv[++i]);
+        else if (!strcmp(argv[i], "-w") && i + 1 < argc) cw = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-h") && i + 1 < argc) ch = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-a") && i + 1 < argc) adv = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-f") && i + 1 < argc) fallback = (uint32_t)strtoul(argv[++i], NULL, 0);
+        else if (!path) path = argv[i];
+        else die("kullanım: bdf2font [-n isim] [-r aralıklar] [-w W] [-h H] [-a adım] [-f yedek] font.bdf");
+    }
+    if (!path) die("girdi yok");
+
+    FILE *f = fopen(path, "r");
+    if (!f) die("girdi açılamadı");
+
+    char line[512];
+    int fbw = 0, fbh = 0, fbx = 0, fby = 0, ascent = -1000;
+    long enc = -1;
+    int bw = 0, bh = 0, bx = 0, by = 0, row = -1;
+    int col_bytes = 0;
+    uint8_t *cur = NULL;
+
+    while (fgets(line, sizeof line, f)) {
+        if (starts(line, "FONTBOUNDINGBOX")) {
+            sscanf(line + 15, "%d %d %d %d", &fbw, &fbh, &fbx, &fby);
+        } else if (starts(line, "FONT_ASCENT")) {
+            sscanf(line + 11, "%d", &ascent);
+        } else if (starts(line, "STARTCHAR")) {
+            /* hücre boyutu ilk glifte kesinleşir */
+            if (!cw) cw = fbw;
+            if (!ch) ch = fbh;
+            if (cw <= 0 || ch <= 0 || ch > 16 || cw > 255) die("geçersiz hücre boyutu (h <= 16)");
+            if (ascent == -1000) ascent = fbh + fby;
+            col_bytes = (ch + 7) / 8;
+            enc = -1;
+            row = -1;
+            cur = NULL;
+        } else if (starts(line, "ENCODING")) {
+            enc = strtol(line + 8, NULL, 10);
+        } else if (starts(line, "BBX")) {
+            sscanf(line + 3, "%d %d %d %d", &bw, &bh, &bx, &by);
+        } else if (starts(line, "BITMAP")) {
+            if (enc >= 0 && enc < MAX_CP && in_ranges((uint32_t)enc) && !glyphs[enc].bits) {
+                cur = calloc((size_t)cw * col_bytes, 1);
+                glyphs[enc].bits = cur;
+            }
+            row = 0;
+        } else if (starts(line, "ENDCHAR")) {
+            row = -1;
+            cur = NULL;
+        } else if (row >= 0) {
+            /* hex satır: soldan sağa, MSB = sol piksel */
+            if (cur) {
+                int y = ascent - (by + bh) + row;
+                for (int c = 0; c < bw && y >= 0 && y < ch; c++) {
+                    int nib = c >> 2;
+                    if (!line[nib] || line[nib] == '\n' || line[nib] == '\r') break;
+                    char hex[2] = { line[nib], 0 };
+                    int v = (int)strtol(hex, NULL, 16);
+                    int x = bx - (fbx < 0 ? fbx : 0) + c;
+                    if (((v >> (3 - (c & 3))) & 1) && x >= 0 && x < cw)
+                        cur[x * col_bytes + (y >> 3)] |= (uint8_t)(1u << (y & 7));
+                }
+            }
+            row++;
+        }
+    }
+    fclose(f);
+    if (!col_bytes) die("glif yok");
+    if (!adv) adv = cw + 1;
+    if (fallback >= MAX_CP || !glyphs[fallback].bits) die("yedek glif fontta yok (-f)");
+
+    /* blok tablosu */
+    int map_len = 0, n_blocks = 0;
+    for (int b = 0; b < MAX_CP / 128; b++)
+        for (int i = 0; i < 128; i++)
+            if (glyphs[b * 128 + i].bits) { map_len = b + 1; n_blocks++; break; }
+    if (n_blocks > 255) die("en fazla 255 dolu blok (map uint8_t, 0xFF = boş)");
+    n_blocks = 0;
+
+    printf("/* tools/bdf2font ile üretildi: %s (%dx%d, adım %d) */\n\n", path, cw, ch, adv);
+    printf("#include \"oled_font.h\"\n\n");
+
+    for (int b = 0; b < map_len; b++) {
+        int n = 0;
+        for (int i = 0; i < 128; i++) n += glyphs[b * 128 + i].bits != NULL;
+        if (!n) continue;
+        printf("static const uint8_t %s_B%d[%d][%d] = {\n", name, b, n, cw * col_bytes);
+        for (int i = 0; i < 128; i++) {
+            const uint8_t *g = glyphs[b * 128 + i].bits;
+            if (!g) continue;
+            printf("  {");
+            for (int k = 0; k < cw * col_bytes; k++) printf("0x%02X%s", g[k], k + 1 < cw * col_bytes ? "," : "");
+            printf("}, // U+%04X\n", b * 128 + i);
+        }
+        printf("};\n\n");
+    }
+
+    printf("static const ssd1322_font_block_t %s_Blocks[] = {\n", name);
+    for (int b = 0; b < map_len; b++) {
+        uint32_t present[4] = { 0, 0, 0, 0 };
+        for (int i = 0; i < 128; i++)
+            if (glyphs[b * 128 + i].bits) present[i >> 5] |= 1u << (i & 31);
+        if (!(present[0] | present[1] | present[2] | present[3])) continue;
+
+        int rank[4], r = 0;
+        for (int w = 0; w < 4; w++) { rank[w] = r; r += __builtin_popcount(present[w]); }
+        printf("  { {0x%08X,0x%08X,0x%08X,0x%08X}, {%d,%d,%d,%d}, &%s_B%d[0][0] }, // U+%04X..U+%04X\n",
+               present[0], present[1], present[2], present[3], rank[0], rank[1], rank[2], rank[3],
+               name, b, b * 128, b * 128 + 127);
+    }
+    printf("};\n\n");
+
+    printf("static const uint8_t %s_Map[%d] = {", name, map_len);
+    for (int b = 0; b < map_len; b++) {
+        int used = 0;
+        for (int i = 0; i < 128 && !used; i++) used = glyphs[b * 128 + i].bits != NULL;
+        if (used) printf(" %d", n_blocks++);
+        else      printf(" 0xFF");
+        printf("%s", b + 1 < map_len ? "," : " ");
+    }
+    printf("};\n\n");
+
+    printf("const ssd1322_font_t %s = {\n", name);
+    printf("    %s_Map, %s_Blocks, %d,\n", name, name, map_len);
+    printf("    %d, %d,   // w, h\n", cw, ch);
+    printf("    %d,      // adım\n", adv);
+    printf("    %d,      // col_bytes\n", col_bytes);
+    printf("    0x%04X\n", fallback);
+    printf("};\n");
+    return 0;
+}
@@ -0,0 +1,211 @@
+/* tools/ssd1322_aafont.c - TTF/OTF fontu ssd1322_aa_font_t C kaynağına pişirir (PC aracı)
+ *
+ * Derleme:  gcc -O2 -o ssd1322_aafont tools/ssd1322_aafont.c $(pkg-config --cflags --libs freetype2)
+ * Kullanım: ssd1322_aafont [-n isim] [-p piksel] [-s kat] [-r aralıklar] [-f yedek] font.ttf > cikti.c
+ *   -p:  em boyu, piksel (varsayılan 8)
+ *   -s:  süper örnekleme katı (varsayılan 4): glif p*s boyunda tek renk
+ *        taranır, s x s kutularının dolu oranı 4-bit kapsama olur
+ *   -r:  kod noktası aralıkları, ör. "0x20-0x7E,0xC7,0xE7" (varsayılan ASCII + Türkçe)
+ *   -f:  olmayan kod noktası yerine çizilecek glif (varsayılan '?')
+ *
+ * Çıktı oled_aafont.h'deki formattadır: sıralı kod noktaları, glif
+ * tablosu ve satır başlıklı 4-bit kapsama atlası.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#define MAX_RANGES  32
+#define MAX_GLYPHS  1024
+#define MAX_ATLAS   65535
+#define GRID        64      /* düşük çözünürlük ızgarası (glif başına) */
+
+typedef struct {
+    uint32_t cp;
+    uint16_t offset;
+    uint8_t  w, h, advance;
+    int8_t   dx, dy;
+} out_glyph_t;
+
+static uint32_t range_lo[MAX_RANGES], range_hi[MAX_RANGES];
+static int n_ranges;
+
+static out_glyph_t glyphs[MAX_GLYPHS];
+static int n_glyphs;
+static uint8_t atlas[MAX_ATLAS];
+static int atlas_len;
+
+static void die(const char *msg)
+{
+    fprintf(stderr, "ssd1322_aafont: %s\n", msg);
+    exit(1);
+}
+
+static void parse_ranges(const char *s)
+{
+    n_ranges = 0;
+    while (*s) {
+        char *end;
+        if (n_ranges == MAX_RANGES) die("çok fazla aralık");
+        range_lo[n_ranges] = (uint32_t)strtoul(s, &end, 0);
+        range_hi[n_ranges] = range_lo[n_ranges];
+        if (*end == '-') range_hi[n_ranges] = (uint32_t)strtoul(end + 1, &end, 0);
+        if (end == s || range_hi[n_ranges] > 0xFFFF || range_hi[n_ranges] < range_lo[n_ranges])
+            die("bozuk aralık");
+        n_ranges++;
+        s = end;
+        if (*s == ',') s++;
+    }
+}
+
+static int floor_div(int a, int b)
+{
+    return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+static void atlas_put(int b)
+{
+    if (atlas_len == MAX_ATLAS) die("atlas 64 KB'ı aşıyor");
+    atlas[atlas_len++] = (uint8_t)b;
+}
+
+/* Glifi s katında tarar, kutulara toplar ve atlasa satır satır yazar */
+static void bake(FT_Face face, uint32_t cp, int ss, int asc_hi)
+{
+    static uint16_t count[GRID][GRID];
+    FT_UInt gi = FT_Get_Char_Index(face, cp);
+    if (!gi) return;
+    if (FT_Load_Glyph(face, gi, FT_LOAD_RENDER | FT_LOAD_MONOCHROME | FT_LOAD_TARGET_MONO))
+        return;
+    if (n_glyphs == MAX_GLYPHS) die("çok fazla glif");
+
+    FT_GlyphSlot slot = face->glyph;
+    FT_Bitmap *bm = &slot->bitmap;
+    memset(count, 0, sizeof(count));
+
+    /* ızgara başı: kalem x = 0, satır üstü y = 0; GRID/2 kadar sola taşabilir */
+    const int ox = GRID / 2;
+    int minx = GRID, miny = GRID, maxx = -1, maxy = -1;
+    for (unsigned j = 0; j < bm->rows; j++) {
+        for (unsigned i = 0; i < bm->width; i++) {
+            if (!((bm->buffer[j * bm->pitch + (i >> 3)] >> (7 - (i & 7))) & 1)) continue;
+            int X = floor_div(slot->bitmap_left + (int)i, ss) + ox;
+            int Y = floor_div(asc_hi - slot->bitmap_top + (int)j, ss);
+            if (X < 0 || X >= GRID || Y < 0 || Y >= GRID) die("glif ızgaraya sığmıyor");
+            count[Y][X]++;
+        }
+    }
+
+    /* kapsama ve kutu */
+    static uint8_t cov[GRID][GRID];
+    for (int y = 0; y < GRID; y++)
+        for (int x = 0; x < GRID; x++) {
+            cov[y][x] = (uint8_t)((count[y][x] * 15 + ss * ss / 2) / (ss * ss));
+            if (!cov[y][x]) continue;
+            if (x < minx) minx = x;
+            if (x > maxx) maxx = x;
+            if (y < miny) miny = y;
+            if (y > maxy) maxy = y;
+        }
+
+    out_glyph_t *g = &glyphs[n_glyphs++];
+    g->cp = cp;
+    g->advance = (uint8_t)((slot->advance.x / 64 + ss / 2) / ss);
+    g->offset = (uint16_t)atlas_len;
+    if (maxx < 0) {   /* boşluk */
+        g->w = g->h = 0;
+        g->dx = g->dy = 0;
+        return;
+    }
+    g->w = (uint8_t)(maxx - minx + 1);
+    g->h = (uint8_t)(maxy - miny + 1);
+    g->dx = (int8_t)(minx - ox);
+    g->dy = (int8_t)miny;
+    if (g->w > 15) die("glif 15 pikselden geniş (-p küçültün)");
+
+    for (int y = miny; y <= maxy; y++) {
+        int a = minx, b = maxx;
+        while (a <= maxx && !cov[y][a]) a++;
+        while (b >= a && !cov[y][b]) b--;
+        if (a > b) { atlas_put(0); continue; }
+        int n = b - a + 1;
+        atlas_put((a - minx) << 4 | n);
+        for (int i = 0; i < n; i += 2)
+            atlas_put(cov[y][a + i] << 4 | (i + 1 < n ? cov[y][a + i + 1] : 0));
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *name = "FontAA_Custom", *path = NULL;
+    int px = 8, ss = 4;
+    uint32_t fallback = '?';
+
+    parse_ranges("0x20-0x7E,0xB0,0xC7,0xD6,0xDC,0xE7,0xF6,0xFC,0x11E-0x11F,0x130-0x131,0x15E-0x15F");
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc)      name = argv[++i];
+        else if (!strcmp(argv[i], "-p") && i + 1 < argc) px = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-s") && i + 1 < argc) ss = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-r") && i + 1 < argc) parse_ranges(argv[++i]);
+        else if (!strcmp(argv[i], "-f") && i + 1 < argc) fallback = (uint32_t)strtoul(argv[++i], NULL, 0);
+        else if (!path) path = argv[i];
+        else die("kullanım: ssd1322_aafont [-n isim] [-p piksel] [-s kat] [-r aralıklar] [-f yedek] font.ttf");
+    }
+    if (!path) die("font dosyası verilmedi");
+    if (px < 4 || px > 32 || ss < 1 || ss > 8) die("geçersiz -p / -s");
+
+    FT_Library lib;
+    FT_Face face;
+    if (FT_Init_FreeType(&lib) || FT_New_Face(lib, path, 0, &face)) die("font açılamadı");
+    if (FT_Set_Pixel_Sizes(face, 0, (FT_UInt)(px * ss))) die("boyut ayarlanamadı");
+
+    int asc_hi = (int)(face->size->metrics.ascender / 64);
+    int desc_hi = (int)(-face->size->metrics.descender / 64);
+    int baseline = (asc_hi + ss / 2) / ss;
+    int height = (asc_hi + desc_hi + ss - 1) / ss;
+
+    /* aralıklar artan sırada taranır, kod noktaları sıralı çıkar */
+    for (uint32_t cp = 0; cp <= 0xFFFF; cp++) {
+        int in = 0;
+        for (int r = 0; r < n_ranges; r++)
+            if (cp >= range_lo[r] && cp <= range_hi[r]) in = 1;
+        if (in) bake(face, cp, ss, asc_hi);
+    }
+    if (!n_glyphs) die("hiç glif yok");
+
+    printf("/* %s - %s, %d piksel, %dx süper örnekleme (tools/ssd1322_aafont) */\n\n", name, path, px, ss);
+    printf("#include \"oled_aafont.h\"\n\n");
+
+    printf("static const uint16_t %s_codes[%d] = {", name, n_glyphs);
+    for (int i = 0; i < n_glyphs; i++)
+        printf("%s0x%04X,", i % 12 ? " " : "\n    ", (unsigned)glyphs[i].cp);
+    printf("\n};\n\n");
+
+    printf("static const ssd1322_aa_glyph_t %s_glyphs[%d] = {\n", name, n_glyphs);
+    for (int i = 0; i < n_glyphs; i++) {
+        const out_glyph_t *g = &glyphs[i];
+        printf("    { %5u, %2u, %2u, %2d, %2d, %2u },   /* U+%04X", g->offset, g->w, g->h, g->dx, g->dy,
+               g->advance, (unsigned)g->cp);
+        if (g->cp >= 0x21 && g->cp < 0x7F && g->cp != '/' && g->cp != '*') printf(" '%c'", (char)g->cp);
+        printf(" */\n");
+    }
+    printf("};\n\n");
+
+    printf("static const uint8_t %s_atlas[%d] = {", name, atlas_len);
+    for (int i = 0; i < atlas_len; i++)
+        printf("%s0x%02X,", i % 16 ? " " : "\n    ", atlas[i]);
+    printf("\n};\n\n");
+
+    printf("const ssd1322_aa_font_t %s = {\n", name);
+    printf("    %s_codes, %s_glyphs, %s_atlas,\n", name, name, name);
+    printf("    %d, %d, %d, 0x%04X,\n", n_glyphs, height, baseline, (unsigned)fallback);
+    printf("};\n");
+
+    FT_Done_Face(face);
+    FT_Done_FreeType(lib);
+    return 0;
+}
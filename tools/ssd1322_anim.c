@@ -0,0 +1,327 @@
+/* tools/ssd1322_anim.c - kare dizisini delta kodlu SSD1322 animasyonuna pişirir (PC aracı)
+ *
+ * Derleme:  gcc -O2 -pthread -o ssd1322_anim tools/ssd1322_anim.c
+ * Kullanım: ssd1322_anim [-n isim] [-f ms] [-k aralık] [-j iş] [-bin] kare0.pgm kare1.pgm ...
+ *   kareler: 128x64 PGM (P5/P2), sırayla
+ *   -f:  kare süresi, ms (varsayılan 40)
+ *   -k:  anahtar kare aralığı (varsayılan 25, 0 = sadece kare 0); atlama (seek) içindir
+ *   -j:  iş parçacığı (varsayılan çekirdek sayısı)
+ *   -bin: C kaynağı yerine ham akış yazar
+ *
+ * Sürücüyle çizilen kareler (Linux, host/ HAL karşılığıyla):
+ *   gcc -O2 -pthread -DANIM_RENDER -Ihost -I. -o anim_bake tools/ssd1322_anim.c cizim.c \
+ *       host/hal_host.c oled_ssd1322.c oled_font.c font6x8.c font6x8_tr.c ...
+ *   anim_bake [seçenekler] -render N
+ * cizim.c'deki void anim_render(int kare) framebuf'a çizer. Sürücünün çizim
+ * hedefi global olduğu için çizim sıralıdır, kodlama paraleldir.
+ *
+ * Kareler önce paralel yüklenir (PGM -> 0..15), sonra her delta, anahtar kare
+ * ve döngü deltası ayrı iş olarak paralel kodlanır ve sırayla birleştirilir.
+ * Delta: satır başına değişen kolon aralığı; ardışık satırlar, birleşik
+ * pencere ayrı pencereden (16 byte başlık) ucuzsa tek pencerede toplanır.
+ * Çıktı oled_anim.h'deki formattadır.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#ifdef ANIM_RENDER
+#include "oled_ssd1322.h"
+SPI_HandleTypeDef hspi2;
+void anim_render(int frame);
+#endif
+
+#define PANEL_W    128
+#define PANEL_H    64
+#define MAX_FRAMES 65535
+#define WIN_COST   16      /* pencere başlığı: 0x15, 0x75, 0x5C, DATA */
+
+static void die(const char *msg)
+{
+    fprintf(stderr, "ssd1322_anim: %s\n", msg);
+    exit(1);
+}
+
+/* --- girdi --- */
+
+static int pgm_int(FILE *f)
+{
+    int c, v = 0;
+    do {
+        c = fgetc(f);
+        if (c == '#') while (c != '\n' && c != EOF) c = fgetc(f);
+    } while (c == ' ' || c == '\t' || c == '\n' || c == '\r');
+    if (c < '0' || c > '9') return -1;
+    while (c >= '0' && c <= '9') { v = v * 10 + (c - '0'); c = fgetc(f); }
+    return v;
+}
+
+/* 128x64 PGM -> g (0..15); hata metni ya da NULL */
+static const char *load_pgm(const char *path, uint8_t *g)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) return "kare açılamadı";
+    char m[2];
+    const char *err = NULL;
+    if (fread(m, 1, 2, f) != 2 || m[0] != 'P' || (m[1] != '5' && m[1] != '2')) {
+        err = "P5/P2 PGM bekleniyor";
+    } else {
+        int w = pgm_int(f), h = pgm_int(f), maxval = pgm_int(f);
+        if (w != PANEL_W || h != PANEL_H) err = "kare 128x64 olmalı";
+        else if (maxval <= 0 || maxval > 65535) err = "geçersiz PGM başlığı";
+        for (int i = 0; !err && i < PANEL_W * PANEL_H; i++) {
+            int v;
+            if (m[1] == '2')       v = pgm_int(f);
+            else if (maxval < 256) v = fgetc(f);
+            else                   { int hi = fgetc(f); v = (hi << 8) | fgetc(f); }
+            if (v < 0) err = "PGM kısa";
+            else       g[i] = (uint8_t)((v * 15 + maxval / 2) / maxval);
+        }
+    }
+    fclose(f);
+    return err;
+}
+
+/* --- çıktı tamponu --- */
+
+typedef struct {
+    uint8_t *p;
+    size_t len, cap;
+} buf_t;
+
+static void put(buf_t *b, uint8_t v)
+{
+    if (b->len == b->cap) {
+        b->cap = b->cap ? b->cap * 2 : 256;
+        b->p = realloc(b->p, b->cap);
+        if (!b->p) die("bellek yetmedi");
+    }
+    b->p[b->len++] = v;
+}
+
+static void put_cmd(buf_t *b, uint8_t cmd, uint8_t d0, uint8_t d1, int n)
+{
+    put(b, 0x01);
+    put(b, (uint8_t)(n + 1));
+    put(b, cmd);
+    if (n > 0) put(b, d0);
+    if (n > 1) put(b, d1);
+}
+
+/* Pencere: adres komutları, Write RAM, en fazla 0xFFFE byte'lık DATA kayıtları */
+static void put_window(buf_t *b, const uint8_t *g, int x0, int y0, int x1, int y1)
+{
+    put_cmd(b, 0x15, (uint8_t)x0, (uint8_t)x1, 2);
+    put_cmd(b, 0x75, (uint8_t)y0, (uint8_t)y1, 2);
+    put_cmd(b, 0x5C, 0, 0, 0);
+
+    size_t total = (size_t)(x1 - x0 + 1) * (y1 - y0 + 1) * 2, chunk_left = 0;
+    for (int y = y0; y <= y1; y++) {
+        for (int x = x0; x <= x1; x++) {
+            if (!chunk_left) {
+                size_t n = total > 0xFFFE ? 0xFFFE : total;
+                put(b, 0x02);
+                put(b, (uint8_t)(n & 0xFF));
+                put(b, (uint8_t)(n >> 8));
+                chunk_left = n;
+                total -= n;
+            }
+            uint8_t v = g[y * PANEL_W + x];
+            v = (uint8_t)((v << 4) | v);
+            put(b, v);
+            put(b, v);
+            chunk_left -= 2;
+        }
+    }
+}
+
+/* prev NULL = tam kare */
+static void encode(buf_t *b, const uint8_t *prev, const uint8_t *g)
+{
+    if (!prev) {
+        put_window(b, g, 0, 0, PANEL_W - 1, PANEL_H - 1);
+        put(b, 0x00);
+        return;
+    }
+
+    int wx0 = 0, wy0 = 0, wx1 = -1, wy1 = 0;   /* açık pencere, wx1 < 0 = yok */
+    for (int y = 0; y < PANEL_H; y++) {
+        const uint8_t *a = prev + y * PANEL_W, *c = g + y * PANEL_W;
+        int x0 = 0, x1 = PANEL_W - 1;
+        while (x0 < PANEL_W && a[x0] == c[x0]) x0++;
+        if (x0 == PANEL_W) continue;
+        while (a[x1] == c[x1]) x1--;
+
+        if (wx1 >= 0) {
+            int mx0 = x0 < wx0 ? x0 : wx0, mx1 = x1 > wx1 ? x1 : wx1;
+            long merged = (long)(y - wy0 + 1) * (mx1 - mx0 + 1) * 2;
+            long apart  = (long)(wy1 - wy0 + 1) * (wx1 - wx0 + 1) * 2 + (x1 - x0 + 1) * 2 + WIN_COST;
+            if (merged <= apart) {
+                wx0 = mx0;
+                wx1 = mx1;
+                wy1 = y;
+                continue;
+            }
+            put_window(b, g, wx0, wy0, wx1, wy1);
+        }
+        wx0 = x0; wx1 = x1; wy0 = wy1 = y;
+    }
+    if (wx1 >= 0) put_window(b, g, wx0, wy0, wx1, wy1);
+    put(b, 0x00);
+}
+
+/* --- paralel işler --- */
+
+static int n_frames, key_every = 25;
+static uint8_t **frames;
+static const char **paths;
+
+/* iş j: j < n_frames -> delta j (0 tam), j == n_frames -> döngü deltası, sonrası anahtar kareler */
+static int n_jobs;
+static buf_t *job_out;
+static int next_job;
+static pthread_mutex_t job_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static int key_frame(int k)
+{
+    return key_every ? k * key_every : 0;
+}
+
+static int take_job(int limit)
+{
+    pthread_mutex_lock(&job_lock);
+    int j = next_job < limit ? next_job++ : -1;
+    pthread_mutex_unlock(&job_lock);
+    return j;
+}
+
+static void *load_worker(void *arg)
+{
+    (void)arg;
+    int i;
+    while ((i = take_job(n_frames)) >= 0) {
+        const char *err = load_pgm(paths[i], frames[i]);
+        if (err) {
+            fprintf(stderr, "ssd1322_anim: %s: %s\n", paths[i], err);
+            exit(1);
+        }
+    }
+    return NULL;
+}
+
+static void *encode_worker(void *arg)
+{
+    (void)arg;
+    int j;
+    while ((j = take_job(n_jobs)) >= 0) {
+        if (j < n_frames)       encode(&job_out[j], j ? frames[j - 1] : NULL, frames[j]);
+        else if (j == n_frames) encode(&job_out[j], frames[n_frames - 1], frames[0]);
+        else                    encode(&job_out[j], NULL, frames[key_frame(j - n_frames)]);
+    }
+    return NULL;
+}
+
+static void run_parallel(void *(*fn)(void *), int threads)
+{
+    pthread_t t[64];
+    next_job = 0;
+    for (int i = 0; i < threads; i++)
+        if (pthread_create(&t[i], NULL, fn, NULL)) die("iş parçacığı açılamadı");
+    for (int i = 0; i < threads; i++) pthread_join(t[i], NULL);
+}
+
+static void put16(buf_t *b, unsigned v) { put(b, (uint8_t)v); put(b, (uint8_t)(v >> 8)); }
+static void put32(buf_t *b, size_t v)   { put16(b, (unsigned)(v & 0xFFFF)); put16(b, (unsigned)(v >> 16)); }
+
+int main(int argc, char **argv)
+{
+    const char *name = "Anim_Stream";
+    int frame_ms = 40, threads = (int)sysconf(_SC_NPROCESSORS_ONLN), bin = 0, render = 0;
+
+    paths = calloc((size_t)argc, sizeof(*paths));
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc)      name = argv[++i];
+        else if (!strcmp(argv[i], "-f") && i + 1 < argc) frame_ms = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-k") && i + 1 < argc) key_every = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-j") && i + 1 < argc) threads = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-bin"))               bin = 1;
+#ifdef ANIM_RENDER
+        else if (!strcmp(argv[i], "-render") && i + 1 < argc) render = atoi(argv[++i]);
+#endif
+        else if (argv[i][0] != '-')                      paths[n_frames++] = argv[i];
+        else die("kullanım: ssd1322_anim [-n isim] [-f ms] [-k aralık] [-j iş] [-bin] kare.pgm ...");
+    }
+    if (render) n_frames = render;
+    if (n_frames <= 0 || n_frames > MAX_FRAMES) die("kare yok ya da çok fazla");
+    if (frame_ms <= 0 || frame_ms > 65535 || key_every < 0) die("geçersiz -f / -k");
+    if (threads < 1) threads = 1;
+    if (threads > 64) threads = 64;
+
+    frames = malloc((size_t)n_frames * sizeof(*frames));
+    for (int i = 0; i < n_frames; i++) frames[i] = malloc(PANEL_W * PANEL_H);
+
+    if (render) {
+#ifdef ANIM_RENDER
+        for (int i = 0; i < n_frames; i++) {
+            anim_render(i);
+            for (int p = 0; p < PANEL_W * PANEL_H; p++)
+                frames[i][p] = (uint8_t)((framebuf[p / PANEL_W][p % PANEL_W] & 0x03) * 5);
+        }
+#endif
+    } else {
+        run_parallel(load_worker, threads);
+    }
+
+    int n_keys = key_every ? (n_frames - 1) / key_every + 1 : 1;
+    n_jobs = n_frames + 1 + (n_keys - 1);       /* anahtar 0 = delta 0, tekrar kodlanmaz */
+    job_out = calloc((size_t)n_jobs, sizeof(*job_out));
+    run_parallel(encode_worker, threads);
+
+    /* birleştir: başlık, anahtar tablosu, deltalar, döngü, anahtar kareler */
+    buf_t out = { 0 };
+    size_t hdr = 14 + (size_t)n_keys * 10, off = hdr;
+    size_t *delta_off = malloc(((size_t)n_frames + 1) * sizeof(size_t));
+    for (int i = 0; i <= n_frames; i++) {
+        delta_off[i] = off;
+        off += job_out[i].len;
+    }
+    if (off > 0xFFFFFFFFu) die("akış 4 GB'ı aşıyor");
+
+    put(&out, 'A'); put(&out, 'N'); put(&out, 'M'); put(&out, '1');
+    put16(&out, (unsigned)n_frames);
+    put16(&out, (unsigned)frame_ms);
+    put16(&out, (unsigned)n_keys);
+    put32(&out, delta_off[n_frames]);
+    for (int k = 0; k < n_keys; k++) {
+        int f = key_frame(k);
+        size_t key = k ? off : delta_off[0];
+        if (k) off += job_out[n_frames + k].len;
+        put16(&out, (unsigned)f);
+        put32(&out, key);
+        put32(&out, delta_off[f + 1]);    /* f = n_frames - 1 ise döngü deltası, kullanılmaz */
+    }
+    for (int j = 0; j < n_jobs; j++)
+        for (size_t i = 0; i < job_out[j].len; i++) put(&out, job_out[j].p[i]);
+
+    size_t delta_bytes = delta_off[n_frames] - delta_off[1];
+    fprintf(stderr, "ssd1322_anim: %d kare, %d anahtar, %zu byte (delta ortalaması %zu byte/kare)\n",
+            n_frames, n_keys, out.len, n_frames > 1 ? delta_bytes / (size_t)(n_frames - 1) : (size_t)0);
+
+    if (bin) {
+        fwrite(out.p, 1, out.len, stdout);
+        return 0;
+    }
+
+    printf("/* tools/ssd1322_anim ile üretildi: %d kare, %d ms, anahtar aralığı %d */\n\n",
+           n_frames, frame_ms, key_every);
+    printf("#include \"oled_anim.h\"\n\n");
+    printf("const uint8_t %s[%zu] = {\n", name, out.len);
+    for (size_t i = 0; i < out.len; i++)
+        printf("0x%02X,%s", out.p[i], (i % 16 == 15 || i + 1 == out.len) ? "\n" : " ");
+    printf("};\n");
+    return 0;
+}
@@ -0,0 +1,197 @@
+/* tools/ssd1322_bake.c - sabit ekranları SSD1322 wire formatına pişirir (PC aracı)
+ *
+ * Derleme:  gcc -O2 -o ssd1322_bake tools/ssd1322_bake.c
+ * Kullanım: ssd1322_bake [-n isim] [-x X] [-y Y] [-bin] girdi > cikti
+ *   girdi:  PGM (P5/P2) ya da "-raw W H BPP dosya" (paketli 2/4bpp, MSB = sol piksel,
+ *           NHD_Logo düzeni)
+ *   -bin:   C kaynağı yerine ham akış yazar
+ *
+ * Çıktı oled_wire.h'deki kayıt formatındadır: pencere komutları (0x15, 0x75),
+ * Write RAM (0x5C) ve piksel başına 2 byte GDDRAM verisi (sürücünün
+ * SSD1322_PackLine çıktısıyla aynı).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define PANEL_W 128
+#define PANEL_H 64
+
+typedef struct {
+    int w, h;
+    uint8_t *g;     /* 0..15 */
+} image_t;
+
+static void die(const char *msg)
+{
+    fprintf(stderr, "ssd1322_bake: %s\n", msg);
+    exit(1);
+}
+
+static int pgm_int(FILE *f)
+{
+    int c, v = 0;
+    do {
+        c = fgetc(f);
+        if (c == '#') while (c != '\n' && c != EOF) c = fgetc(f);
+    } while (c == ' ' || c == '\t' || c == '\n' || c == '\r');
+    if (c < '0' || c > '9') die("bozuk PGM");
+    while (c >= '0' && c <= '9') { v = v * 10 + (c - '0'); c = fgetc(f); }
+    return v;
+}
+
+static image_t load_pgm(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) die("girdi açılamadı");
+    char m[2];
+    if (fread(m, 1, 2, f) != 2 || m[0] != 'P' || (m[1] != '5' && m[1] != '2')) die("P5/P2 PGM bekleniyor");
+
+    image_t im;
+    im.w = pgm_int(f);
+    im.h = pgm_int(f);
+    int maxval = pgm_int(f);
+    if (im.w <= 0 || im.h <= 0 || maxval <= 0 || maxval > 65535) die("geçersiz PGM başlığı");
+    im.g = malloc((size_t)im.w * im.h);
+
+    for (int i = 0; i < im.w * im.h; i++) {
+        int v;
+        if (m[1] == '2') {
+            v = pgm_int(f);
+        } else if (maxval < 256) {
+            v = fgetc(f);
+        } else {
+            int hi = fgetc(f);
+            v = (hi << 8) | fgetc(f);
+        }
+        if (v < 0) die("PGM kısa");
+        im.g[i] = (uint8_t)((v * 15 + maxval / 2) / maxval);
+    }
+    fclose(f);
+    return im;
+}
+
+static image_t load_raw(int w, int h, int bpp, const char *path)
+{
+    if (bpp != 2 && bpp != 4) die("BPP 2 ya da 4 olmalı");
+    FILE *f = fopen(path, "rb");
+    if (!f) die("girdi açılamadı");
+
+    int stride = (w * bpp + 7) / 8;
+    uint8_t *buf = malloc((size_t)stride * h);
+    if (fread(buf, 1, (size_t)stride * h, f) != (size_t)stride * h) die("ham veri kısa");
+    fclose(f);
+
+    image_t im = { w, h, malloc((size_t)w * h) };
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            const uint8_t *row = buf + y * stride;
+            uint8_t v;
+            if (bpp == 4) v = (row[x >> 1] >> (4 - 4 * (x & 1))) & 0x0F;
+            else          v = (uint8_t)(((row[x >> 2] >> (6 - 2 * (x & 3))) & 0x03) * 5);
+            im.g[y * w + x] = v;
+        }
+    }
+    free(buf);
+    return im;
+}
+
+/* --- çıktı --- */
+
+static uint8_t *out;
+static size_t out_len, out_cap;
+
+static void emit(uint8_t b)
+{
+    if (out_len == out_cap) {
+        out_cap = out_cap ? out_cap * 2 : 4096;
+        out = realloc(out, out_cap);
+    }
+    out[out_len++] = b;
+}
+
+static void emit_cmd(uint8_t cmd, const uint8_t *data, int n)
+{
+    emit(0x01);
+    emit((uint8_t)(n + 1));
+    emit(cmd);
+    for (int i = 0; i < n; i++) emit(data[i]);
+}
+
+static void bake(const image_t *im, int x, int y)
+{
+    int x0 = x < 0 ? 0 : x, y0 = y < 0 ? 0 : y;
+    int x1 = x + im->w - 1, y1 = y + im->h - 1;
+    if (x1 > PANEL_W - 1) x1 = PANEL_W - 1;
+    if (y1 > PANEL_H - 1) y1 = PANEL_H - 1;
+    if (x0 > x1 || y0 > y1) die("görüntü ekran dışında");
+
+    emit_cmd(0x15, (uint8_t[]){ (uint8_t)x0, (uint8_t)x1 }, 2);
+    emit_cmd(0x75, (uint8_t[]){ (uint8_t)y0, (uint8_t)y1 }, 2);
+    emit_cmd(0x5C, NULL, 0);
+
+    /* DATA kayıtları en fazla 65535 byte; GDDRAM adresi kendiliğinden ilerler */
+    size_t total = (size_t)(x1 - x0 + 1) * (y1 - y0 + 1) * 2;
+    size_t chunk_left = 0;
+    for (int py = y0; py <= y1; py++) {
+        for (int px = x0; px <= x1; px++) {
+            if (!chunk_left) {
+                size_t n = total > 0xFFFE ? 0xFFFE : total;
+                emit(0x02);
+                emit((uint8_t)(n & 0xFF));
+                emit((uint8_t)(n >> 8));
+                chunk_left = n;
+                total -= n;
+            }
+            uint8_t g = im->g[(py - y) * im->w + (px - x)];
+            uint8_t b = (uint8_t)((g << 4) | g);
+            emit(b);
+            emit(b);
+            chunk_left -= 2;
+        }
+    }
+    emit(0x00);
+}
+
+int main(int argc, char **argv)
+{
+    const char *name = "Wire_Screen";
+    int x = 0, y = 0, bin = 0;
+    image_t im = { 0, 0, NULL };
+    const char *src = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc)      name = argv[++i];
+        else if (!strcmp(argv[i], "-x") && i + 1 < argc) x = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-y") && i + 1 < argc) y = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-bin"))               bin = 1;
+        else if (!strcmp(argv[i], "-raw") && i + 4 < argc) {
+            im = load_raw(atoi(argv[i + 1]), atoi(argv[i + 2]), atoi(argv[i + 3]), argv[i + 4]);
+            src = argv[i + 4];
+            i += 4;
+        } else if (!im.g) {
+            im = load_pgm(argv[i]);
+            src = argv[i];
+        } else {
+            die("kullanım: ssd1322_bake [-n isim] [-x X] [-y Y] [-bin] (girdi.pgm | -raw W H BPP dosya)");
+        }
+    }
+    if (!im.g) die("girdi yok");
+
+    bake(&im, x, y);
+
+    if (bin) {
+        fwrite(out, 1, out_len, stdout);
+        return 0;
+    }
+
+    printf("/* tools/ssd1322_bake ile üretildi: %s (%dx%d @ %d,%d) */\n\n", src, im.w, im.h, x, y);
+    printf("#include \"oled_wire.h\"\n\n");
+    printf("const uint8_t %s[%zu] = {\n", name, out_len);
+    for (size_t i = 0; i < out_len; i++)
+        printf("0x%02X,%s", out[i], (i % 16 == 15 || i + 1 == out_len) ? "\n" : " ");
+    printf("};\n");
+    return 0;
+}
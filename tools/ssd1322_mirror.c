@@ -0,0 +1,178 @@
+/* tools/ssd1322_mirror.c - oled_mirror akışından kareleri geri kurar (PC aracı)
+ *
+ * Derleme:  gcc -O2 -o ssd1322_mirror tools/ssd1322_mirror.c
+ * Kullanım: ssd1322_mirror [-i girdi] [-o kalip] [-l dosya] [-n N] [-v]
+ *   -i:  akış (varsayılan stdin); seri port için önce "stty -F /dev/ttyUSB0 raw 921600"
+ *   -o:  her kareyi PGM yazar, kalıp printf formatı (ör. kare%05d.pgm)
+ *   -l:  son kareyi hep aynı dosyaya yazar (ekran görüntüsü testleri)
+ *   -n:  N geçerli kareden sonra çıkar
+ *   -v:  kare başına satır / byte / kayıp bilgisi (stderr)
+ *
+ * Format oled_mirror.h'de. CRC'si tutmayan kare atılır; alıcı ayna
+ * tazeleme satırlarıyla kendiliğinden toparlanır.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define PANEL_W 128
+#define PANEL_H 64
+#define PK_W    (PANEL_W / 2)
+
+#define SYNC0   0xA5
+#define SYNC1   0x5A
+#define END     0xFF
+
+static FILE    *in;
+static uint16_t crc;
+static long     nread;
+
+static uint8_t  frame[PANEL_H][PK_W];     // paketli 4 bit seviye, son geçerli kare
+static uint8_t  stage[PANEL_H][PK_W];
+
+static void die(const char *msg)
+{
+    fprintf(stderr, "ssd1322_mirror: %s\n", msg);
+    exit(1);
+}
+
+static int get_raw(void)
+{
+    int c = fgetc(in);
+    if (c == EOF) return -1;
+    nread++;
+    return c;
+}
+
+static int get(void)
+{
+    int c = get_raw();
+    if (c < 0) return -1;
+    crc ^= (uint16_t)(c << 8);
+    for (int i = 0; i < 8; i++)
+        crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    return c;
+}
+
+/* 1: kare tamam, 0: bozuk kare, -1: akış bitti */
+static int read_frame(int *seq, int *rows)
+{
+    int c, prev = -1;
+
+    /* senkron ara */
+    for (;;) {
+        if ((c = get_raw()) < 0) return -1;
+        if (prev == SYNC0 && c == SYNC1) break;
+        prev = c;
+    }
+
+    crc = 0xFFFF;
+    if ((*seq = get()) < 0) return -1;
+    memcpy(stage, frame, sizeof(stage));
+    *rows = 0;
+
+    for (;;) {
+        int y = get();
+        if (y < 0) return -1;
+        if (y == END) break;
+        if (y >= PANEL_H) return 0;
+
+        int x0 = get(), n = get();
+        if (x0 < 0 || n < 0) return -1;
+        if (n < 1 || x0 + n > PK_W) return 0;
+
+        uint8_t *p = &stage[y][x0];
+        int i = 0;
+        while (i < n) {
+            if ((c = get()) < 0) return -1;
+            if (c < 0x80) {
+                if (i + c + 1 > n) return 0;
+                for (int k = 0; k <= c; k++) {
+                    int b = get();
+                    if (b < 0) return -1;
+                    p[i++] = (uint8_t)b;
+                }
+            } else {
+                int b = get();
+                if (b < 0) return -1;
+                if (i + c - 125 > n) return 0;
+                for (int k = 0; k < c - 125; k++) p[i++] = (uint8_t)b;
+            }
+        }
+        (*rows)++;
+    }
+
+    uint16_t want = crc;
+    int lo = get_raw(), hi = get_raw();
+    if (lo < 0 || hi < 0) return -1;
+    if ((uint16_t)(lo | (hi << 8)) != want) return 0;
+
+    memcpy(frame, stage, sizeof(frame));
+    return 1;
+}
+
+static void write_pgm(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f) die("çıktı açılamadı");
+    fprintf(f, "P5\n%d %d\n255\n", PANEL_W, PANEL_H);
+    for (int y = 0; y < PANEL_H; y++)
+        for (int x = 0; x < PANEL_W; x++)
+            fputc(((frame[y][x / 2] >> (x & 1 ? 0 : 4)) & 15) * 17, f);
+    fclose(f);
+}
+
+int main(int argc, char **argv)
+{
+    const char *in_path = NULL, *pattern = NULL, *last = NULL;
+    long max_frames = 0;
+    int verbose = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-i") && i + 1 < argc)      in_path = argv[++i];
+        else if (!strcmp(argv[i], "-o") && i + 1 < argc) pattern = argv[++i];
+        else if (!strcmp(argv[i], "-l") && i + 1 < argc) last = argv[++i];
+        else if (!strcmp(argv[i], "-n") && i + 1 < argc) max_frames = strtol(argv[++i], NULL, 0);
+        else if (!strcmp(argv[i], "-v"))                 verbose = 1;
+        else {
+            fprintf(stderr, "kullanım: ssd1322_mirror [-i girdi] [-o kalip] [-l dosya] [-n N] [-v]\n");
+            return 2;
+        }
+    }
+
+    in = in_path ? fopen(in_path, "rb") : stdin;
+    if (!in) die("girdi açılamadı");
+
+    long frames = 0, bad = 0, lost = 0;
+    int expect = -1;
+    for (;;) {
+        long at = nread;
+        int seq, rows;
+        int r = read_frame(&seq, &rows);
+        if (r < 0) break;
+        if (r == 0) {
+            bad++;
+            if (verbose) fprintf(stderr, "bozuk kare\n");
+            continue;
+        }
+
+        if (expect >= 0 && seq != expect) lost += (seq - expect) & 0xFF;
+        expect = (seq + 1) & 0xFF;
+        frames++;
+
+        if (verbose)
+            fprintf(stderr, "kare %ld seq %d: %d satır, %ld byte\n", frames, seq, rows, nread - at);
+        if (pattern) {
+            char path[512];
+            snprintf(path, sizeof(path), pattern, (int)frames);
+            write_pgm(path);
+        }
+        if (last) write_pgm(last);
+        if (max_frames && frames >= max_frames) break;
+    }
+
+    if (verbose) fprintf(stderr, "%ld kare, %ld bozuk, %ld kayıp, %ld byte\n", frames, bad, lost, nread);
+    return 0;
+}